@@ -2,8 +2,163 @@
  * benchmark_main.cpp
  *
  * Main entry point for Google Benchmark suite
+ *
+ * Accepts every Google Benchmark flag plus --perf_counters (or the
+ * STEVENSMATHLIB_PERF_COUNTERS=1 environment variable), which turns on the
+ * hardware counters from perf_counters.h and prints a cycles-per-item table
+ * once all benchmarks have run.
  */
 
+#include "perf_counters.h"
 #include <benchmark/benchmark.h>
+#include <cstdio>
+#include <cstring>
+#include <memory>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <unistd.h>
+#endif
+
+namespace
+{
+    /**
+     * @brief Forwards to the normal display reporter and keeps each run's counters
+     */
+    class CountersTableReporter : public benchmark::BenchmarkReporter
+    {
+    public:
+        explicit CountersTableReporter(std::unique_ptr<benchmark::BenchmarkReporter> display)
+            : display_(std::move(display))
+        {
+        }
+
+        bool ReportContext(const Context& context) override
+        {
+            return display_->ReportContext(context);
+        }
+
+        void ReportRuns(const std::vector<Run>& runs) override
+        {
+            for (const Run& run : runs) {
+                if (run.run_type == Run::RT_Iteration && run.counters.count("cycles_per_item") != 0) {
+                    rows_.push_back({run.benchmark_name(), run.counters});
+                }
+            }
+            display_->ReportRuns(runs);
+        }
+
+        void Finalize() override
+        {
+            display_->Finalize();
+        }
+
+        /**
+         * @brief Prints one row per benchmark; miss counts are per item, like cycles
+         */
+        void printTable(std::FILE* out) const
+        {
+            if (rows_.empty()) {
+                return;
+            }
+            std::fprintf(out, "\n%-56s %14s %8s %14s %14s %14s\n", "Benchmark", "cycles/item",
+                         "IPC", "br-miss/item", "L1d-miss/item", "LLC-miss/item");
+            for (const Row& row : rows_) {
+                const double cyclesPerItem = row.counters.at("cycles_per_item");
+                std::fprintf(out, "%-56s %14.2f %8s %14s %14s %14s\n", row.name.c_str(), cyclesPerItem,
+                             format(row, "IPC", false).c_str(),
+                             format(row, "branch_misses", true).c_str(),
+                             format(row, "l1d_misses", true).c_str(),
+                             format(row, "llc_misses", true).c_str());
+            }
+        }
+
+    private:
+        struct Row
+        {
+            std::string name;
+            benchmark::UserCounters counters;
+        };
+
+        // Per-iteration counters become per-item through the cycles ratio
+        static std::string format(const Row& row, const char* counter, bool perItem)
+        {
+            const auto found = row.counters.find(counter);
+            const auto cycles = row.counters.find("cycles");
+            if (found == row.counters.end() || (perItem && (cycles == row.counters.end() || cycles->second.value <= 0.0))) {
+                return "-";
+            }
+            double value = found->second.value;
+            if (perItem) {
+                value *= row.counters.at("cycles_per_item").value / cycles->second.value;
+            }
+            char text[32];
+            std::snprintf(text, sizeof(text), "%.3f", value);
+            return text;
+        }
+
+        std::unique_ptr<benchmark::BenchmarkReporter> display_;
+        std::vector<Row> rows_;
+    };
+
+    bool stdoutIsTerminal()
+    {
+#if defined(__unix__) || defined(__APPLE__)
+        return isatty(fileno(stdout)) != 0;
+#else
+        return false;
+#endif
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    const bool wantCounters = perfCounters::requestedOnCommandLine(&argc, argv);
+
+    std::string format = "console";
+    bool color = stdoutIsTerminal();
+    for (int i = 1; i < argc; ++i) {
+        if (std::strncmp(argv[i], "--benchmark_format=", 19) == 0) {
+            format = argv[i] + 19;
+        } else if (std::strncmp(argv[i], "--benchmark_color=", 18) == 0) {
+            const std::string value = argv[i] + 18;
+            color = value == "true" || value == "yes" || value == "1" || value == "always";
+        }
+    }
+
+    benchmark::Initialize(&argc, argv);
+    if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+        return 1;
+    }
+
+    if (wantCounters) {
+        perfCounters::CounterSet& counters = perfCounters::CounterSet::instance();
+        if (!counters.enable()) {
+            std::fprintf(stderr, "perf counters unavailable (%s); reporting wall time only\n",
+                         counters.unavailableReason().c_str());
+        }
+    }
+
+    // The table wraps the console and JSON reporters; CSV output still carries the counters
+    if (!wantCounters || (format != "console" && format != "json")) {
+        benchmark::RunSpecifiedBenchmarks();
+        benchmark::Shutdown();
+        return 0;
+    }
 
-BENCHMARK_MAIN();
+    std::unique_ptr<benchmark::BenchmarkReporter> display;
+    if (format == "json") {
+        display = std::make_unique<benchmark::JSONReporter>();
+    } else {
+        display = std::make_unique<benchmark::ConsoleReporter>(
+            color ? benchmark::ConsoleReporter::OO_ColorTabular : benchmark::ConsoleReporter::OO_Tabular);
+    }
+    CountersTableReporter reporter(std::move(display));
+    benchmark::RunSpecifiedBenchmarks(&reporter);
+    // Keep machine-readable output on stdout parseable
+    reporter.printTable(format == "console" ? stdout : stderr);
+    benchmark::Shutdown();
+    return 0;
+}
@@ -5,14 +5,26 @@
  */
 
 #include "../stevensMathLib.h"
+#include "perf_counters.h"
 #include <benchmark/benchmark.h>
+#include <algorithm>
+#include <chrono>
+#include <cstdint>
+#include <cstdio>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
 #include <vector>
 
 using namespace stevensMathLib;
+using perfCounters::PerfCounterScope;
 
 // Benchmark for randomInt
 static void BM_RandomInt_SmallRange(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomInt(0, 10));
     }
@@ -23,6 +35,7 @@ BENCHMARK(BM_RandomInt_SmallRange);
 
 static void BM_RandomInt_MediumRange(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomInt(0, 1000));
     }
@@ -33,6 +46,7 @@ BENCHMARK(BM_RandomInt_MediumRange);
 
 static void BM_RandomInt_LargeRange(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomInt(0, 1000000));
     }
@@ -44,6 +58,7 @@ BENCHMARK(BM_RandomInt_LargeRange);
 // Benchmark for randomFloat
 static void BM_RandomFloat_DefaultRange(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomFloat());
     }
@@ -54,6 +69,7 @@ BENCHMARK(BM_RandomFloat_DefaultRange);
 
 static void BM_RandomFloat_CustomRange(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomFloat(-100.0f, 100.0f));
     }
@@ -62,11 +78,219 @@ static void BM_RandomFloat_CustomRange(benchmark::State& state)
 }
 BENCHMARK(BM_RandomFloat_CustomRange);
 
+// Baselines: the std distributions randomInt() and randomFloat() used to wrap
+static void BM_StdUniformIntDistribution(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::uniform_int_distribution<int> distribution(0, 999);
+        benchmark::DoNotOptimize(distribution(engine));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdUniformIntDistribution);
+
+static void BM_StdUniformRealDistribution(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::uniform_real_distribution<float> distribution(-100.0f, 100.0f);
+        benchmark::DoNotOptimize(distribution(engine));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdUniformRealDistribution);
+
+// Full-range 64-bit integers: two stitched 32-bit draws vs one 64-bit draw
+static void BM_Uint64_StitchedMt19937(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        const std::uint64_t high = engine();
+        benchmark::DoNotOptimize((high << 32) | engine());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Uint64_StitchedMt19937);
+
+static void BM_Uint64_StdUniformIntDistribution(benchmark::State& state)
+{
+    auto& engine = getRandomEngine64();
+    std::uniform_int_distribution<std::uint64_t> distribution(0, std::numeric_limits<std::uint64_t>::max());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(distribution(engine));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Uint64_StdUniformIntDistribution);
+
+static void BM_Uint64_RandomIntegral_FullRange(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomIntegral<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max()));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Uint64_RandomIntegral_FullRange);
+
+static void BM_Uint64_RandomBits(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomBits<std::uint64_t>());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Uint64_RandomBits);
+
+static void BM_Uint64_RandomIntegralBatch_FullRange(benchmark::State& state)
+{
+    std::vector<std::uint64_t> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomIntegralBatch<std::uint64_t>(values.data(), values.size(), 0, std::numeric_limits<std::uint64_t>::max());
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Uint64_RandomIntegralBatch_FullRange)->Arg(4096);
+
+// Bounded 64-bit ids in [0, 10^12): stitched draws with modulo vs Lemire
+static void BM_Int64Bounded_StitchedModulo(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        const std::uint64_t high = engine();
+        benchmark::DoNotOptimize(((high << 32) | engine()) % 1000000000000ull);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Int64Bounded_StitchedModulo);
+
+static void BM_Int64Bounded_RandomIntegral(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomIntegral<std::int64_t>(0, 999999999999ll));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Int64Bounded_RandomIntegral);
+
+static void BM_Int64Bounded_RandomIntegralBatch(benchmark::State& state)
+{
+    std::vector<std::int64_t> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomIntegralBatch<std::int64_t>(values.data(), values.size(), 0, 999999999999ll);
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Int64Bounded_RandomIntegralBatch)->Arg(4096);
+
+// Benchmarks for coin flips: randomInt(0, 2) vs cached bits
+static void BM_CoinFlip_RandomInt(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomInt(0, 2) == 1);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_CoinFlip_RandomInt);
+
+static void BM_RandomBool(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomBool());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomBool);
+
+static void BM_Bernoulli_RandomFloatCompare(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomFloat() < 0.3f);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Bernoulli_RandomFloatCompare);
+
+static void BM_RandomBernoulli(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomBernoulli(0.3));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomBernoulli);
+
+static void BM_RandomBoolMask(benchmark::State& state)
+{
+    std::vector<std::uint64_t> masks(static_cast<std::size_t>(state.range(0)) / 64);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomBoolMask(masks.data(), static_cast<std::size_t>(state.range(0)));
+        benchmark::DoNotOptimize(masks.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomBoolMask)->Arg(1 << 16);
+
+static void BM_RandomBernoulliMask(benchmark::State& state)
+{
+    std::vector<std::uint64_t> masks(static_cast<std::size_t>(state.range(0)) / 64);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomBernoulliMask(masks.data(), static_cast<std::size_t>(state.range(0)), 0.3);
+        benchmark::DoNotOptimize(masks.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomBernoulliMask)->Arg(1 << 16);
+
 // Benchmark for randomIntNotInBlacklist with different scenarios
 static void BM_RandomIntNotInBlacklist_EmptyBlacklist(benchmark::State& state)
 {
     std::vector<int> emptyBlacklist;
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomIntNotInBlacklist(emptyBlacklist, 0, 100));
     }
@@ -79,6 +303,7 @@ static void BM_RandomIntNotInBlacklist_SmallBlacklist(benchmark::State& state)
 {
     std::vector<int> blacklist = {5, 15, 25, 35, 45};
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomIntNotInBlacklist(blacklist, 0, 100));
     }
@@ -94,6 +319,7 @@ static void BM_RandomIntNotInBlacklist_MediumBlacklist(benchmark::State& state)
         blacklist.push_back(i);
     }
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(randomIntNotInBlacklist(blacklist, 0, 100));
     }
@@ -105,6 +331,7 @@ BENCHMARK(BM_RandomIntNotInBlacklist_MediumBlacklist);
 // Benchmark for in_range
 static void BM_InRange_Inclusive_Int(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(in_range(50, 0, 100, BoundType::Inclusive));
     }
@@ -115,6 +342,7 @@ BENCHMARK(BM_InRange_Inclusive_Int);
 
 static void BM_InRange_Exclusive_Int(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(in_range(50, 0, 100, BoundType::Exclusive));
     }
@@ -125,6 +353,7 @@ BENCHMARK(BM_InRange_Exclusive_Int);
 
 static void BM_InRange_Inclusive_Float(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(in_range(50.5f, 0.0f, 100.0f, BoundType::Inclusive));
     }
@@ -135,6 +364,7 @@ BENCHMARK(BM_InRange_Inclusive_Float);
 
 static void BM_InRange_Exclusive_Float(benchmark::State& state)
 {
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         benchmark::DoNotOptimize(in_range(50.5f, 0.0f, 100.0f, BoundType::Exclusive));
     }
@@ -143,14 +373,973 @@ static void BM_InRange_Exclusive_Float(benchmark::State& state)
 }
 BENCHMARK(BM_InRange_Exclusive_Float);
 
-// Benchmark comparing getRandomEngine vs seedRNG
-static void BM_GetRandomEngine(benchmark::State& state)
+// Benchmarks for clamp/remap/lerp/smoothstep kernels over arrays
+static std::vector<float> generateRangeData(std::size_t size)
+{
+    std::vector<float> values(size);
+    for (float& value : values) {
+        value = randomFloat(-50.0f, 150.0f);
+    }
+    return values;
+}
+
+static void BM_InRangeThenClamp_ScalarLoop_Float(benchmark::State& state)
 {
+    const auto values = generateRangeData(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(values.size());
+
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
-        auto& engine = getRandomEngine();
-        benchmark::DoNotOptimize(engine());
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            const float value = values[i];
+            out[i] = in_range(value, 0.0f, 100.0f) ? value : (value < 0.0f ? 0.0f : 100.0f);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_InRangeThenClamp_ScalarLoop_Float)->Arg(4096);
+
+static void BM_ClampBatch_Float(benchmark::State& state)
+{
+    const auto values = generateRangeData(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(values.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        clampBatch(values.data(), out.data(), values.size(), 0.0f, 100.0f);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ClampBatch_Float)->Arg(4096);
+
+static void BM_ClampBatch_Int(benchmark::State& state)
+{
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+    for (int& value : values) {
+        value = randomInt(-500, 1500);
+    }
+    std::vector<int> out(values.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        clampBatch(values.data(), out.data(), values.size(), 0, 1000, BoundType::Exclusive);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ClampBatch_Int)->Arg(4096);
+
+static void BM_Remap_ScalarLoop_Float(benchmark::State& state)
+{
+    const auto values = generateRangeData(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(values.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            out[i] = remap(values[i], 0.0f, 100.0f, -1.0f, 1.0f);
+        }
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Remap_ScalarLoop_Float)->Arg(4096);
+
+static void BM_RemapBatch_Float(benchmark::State& state)
+{
+    const auto values = generateRangeData(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(values.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        remapBatch(values.data(), out.data(), values.size(), 0.0f, 100.0f, -1.0f, 1.0f);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RemapBatch_Float)->Arg(4096);
+
+static void BM_RemapBatch_Int(benchmark::State& state)
+{
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+    for (int& value : values) {
+        value = randomInt(0, 1024);
+    }
+    std::vector<int> out(values.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        remapBatch(values.data(), out.data(), values.size(), 0, 1023, 0, 255);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RemapBatch_Int)->Arg(4096);
+
+static void BM_LerpBatch_Double(benchmark::State& state)
+{
+    std::vector<double> ts(static_cast<std::size_t>(state.range(0)));
+    for (double& t : ts) {
+        t = randomFloat();
+    }
+    std::vector<double> out(ts.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        lerpBatch(ts.data(), out.data(), ts.size(), -10.0, 10.0);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_LerpBatch_Double)->Arg(4096);
+
+static void BM_SmoothstepBatch_Float(benchmark::State& state)
+{
+    const auto values = generateRangeData(static_cast<std::size_t>(state.range(0)));
+    std::vector<float> out(values.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        smoothstepBatch(values.data(), out.data(), values.size(), 0.0f, 100.0f);
+        benchmark::DoNotOptimize(out.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_SmoothstepBatch_Float)->Arg(4096);
+
+// Benchmarks for matching values against many ranges
+static std::vector<Interval<int>> generateIntervals(int count)
+{
+    std::vector<Interval<int>> intervals;
+    for (int i = 0; i < count; ++i) {
+        const int lower = randomInt(0, 1000000);
+        const BoundType boundType = (i % 2 == 0) ? BoundType::Inclusive : BoundType::Exclusive;
+        intervals.push_back({lower, lower + randomInt(1, 5000), boundType});
+    }
+    return intervals;
+}
+
+static void BM_InRange_LoopOverIntervals(benchmark::State& state)
+{
+    const auto intervals = generateIntervals(static_cast<int>(state.range(0)));
+    std::vector<std::size_t> matches;
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        matches.clear();
+        const int value = randomInt(0, 1000000);
+        for (std::size_t id = 0; id < intervals.size(); ++id) {
+            const auto& interval = intervals[id];
+            if (in_range(value, interval.lowerBound, interval.upperBound, interval.boundType)) {
+                matches.push_back(id);
+            }
+        }
+        benchmark::DoNotOptimize(matches.data());
     }
 
     state.SetItemsProcessed(state.iterations());
 }
-BENCHMARK(BM_GetRandomEngine);
+BENCHMARK(BM_InRange_LoopOverIntervals)->Arg(100)->Arg(1000)->Arg(10000);
+
+static void BM_IntervalIndex_FindAll(benchmark::State& state)
+{
+    const IntervalIndex<int> index(generateIntervals(static_cast<int>(state.range(0))));
+    std::vector<std::size_t> matches;
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        matches.clear();
+        index.findAll(randomInt(0, 1000000), matches);
+        benchmark::DoNotOptimize(matches.data());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_IntervalIndex_FindAll)->Arg(100)->Arg(1000)->Arg(10000);
+
+// Benchmarks for picking representatives from a stream
+static void BM_BufferThenRandomInt(benchmark::State& state)
+{
+    std::vector<int> events(static_cast<std::size_t>(state.range(0)), 1);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::vector<int> buffered(events.begin(), events.end());
+        std::vector<int> picked;
+        for (int i = 0; i < 100; ++i) {
+            picked.push_back(buffered[randomInt(0, static_cast<int>(buffered.size()))]);
+        }
+        benchmark::DoNotOptimize(picked.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_BufferThenRandomInt)->Arg(100000);
+
+static void BM_ReservoirSampler_Batch(benchmark::State& state)
+{
+    std::vector<int> events(static_cast<std::size_t>(state.range(0)), 1);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        ReservoirSampler<int> sampler(100);
+        sampler.add(events);
+        benchmark::DoNotOptimize(sampler.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ReservoirSampler_Batch)->Arg(100000);
+
+static void BM_WeightedReservoirSampler(benchmark::State& state)
+{
+    std::vector<double> weights(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = 1.0 + static_cast<double>(i % 7);
+    }
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        WeightedReservoirSampler<std::size_t> sampler(100);
+        for (std::size_t i = 0; i < weights.size(); ++i) {
+            sampler.add(i, weights[i]);
+        }
+        benchmark::DoNotOptimize(sampler.size());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_WeightedReservoirSampler)->Arg(100000);
+
+static void BM_AliasTable_Sample(benchmark::State& state)
+{
+    std::vector<double> weights(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = 1.0 + static_cast<double>(i % 13);
+    }
+    const AliasTable table(weights);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(table.sample());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AliasTable_Sample)->Arg(1000);
+
+static void BM_QuantileSketch_Insert(benchmark::State& state)
+{
+    std::vector<double> values(static_cast<std::size_t>(state.range(0)));
+    for (double& value : values) {
+        value = randomFloat(0.0f, 1000.0f);
+    }
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        QuantileSketch sketch;
+        for (double value : values) {
+            sketch.insert(value);
+        }
+        benchmark::DoNotOptimize(sketch.quantile(0.99));
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_QuantileSketch_Insert)->Arg(100000);
+
+// Benchmarks for dice expressions
+static void BM_Dice_ChainedRandomInt_4d6DropLowest(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        int rolls[4];
+        for (int& roll : rolls) {
+            roll = randomInt(1, 7);
+        }
+        const int total = rolls[0] + rolls[1] + rolls[2] + rolls[3] -
+                          std::min(std::min(rolls[0], rolls[1]), std::min(rolls[2], rolls[3]));
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Dice_ChainedRandomInt_4d6DropLowest);
+
+static void BM_DiceRoll_4d6DropLowest(benchmark::State& state)
+{
+    const DiceRoll dice("4d6 drop lowest");
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dice.roll());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DiceRoll_4d6DropLowest);
+
+static void BM_DiceRoll_10d6Plus5(benchmark::State& state)
+{
+    const DiceRoll dice("10d6+5");
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dice.roll());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DiceRoll_10d6Plus5);
+
+static void BM_DiceRoll_Fallback_100d100kh50(benchmark::State& state)
+{
+    const DiceRoll dice("100d100kh50");
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(dice.roll());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_DiceRoll_Fallback_100d100kh50);
+
+// Benchmarks for discrete distributions: a Bernoulli loop vs one O(1) draw
+static void BM_BernoulliLoop_Binomial(benchmark::State& state)
+{
+    const int trials = static_cast<int>(state.range(0));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        int successes = 0;
+        for (int i = 0; i < trials; ++i) {
+            successes += randomFloat() < 0.3f;
+        }
+        benchmark::DoNotOptimize(successes);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BernoulliLoop_Binomial)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_RandomBinomial(benchmark::State& state)
+{
+    const int trials = static_cast<int>(state.range(0));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomBinomial(trials, 0.3));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomBinomial)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_StdBinomialDistribution(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+    std::binomial_distribution<int> distribution(static_cast<int>(state.range(0)), 0.3);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(distribution(engine));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdBinomialDistribution)->Arg(10)->Arg(1000)->Arg(100000);
+
+static void BM_RandomPoisson(benchmark::State& state)
+{
+    const double mean = static_cast<double>(state.range(0));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomPoisson(mean));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomPoisson)->Arg(4)->Arg(1000)->Arg(1000000);
+
+static void BM_StdPoissonDistribution(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+    std::poisson_distribution<long long> distribution(static_cast<double>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(distribution(engine));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_StdPoissonDistribution)->Arg(4)->Arg(1000)->Arg(1000000);
+
+static void BM_BernoulliLoop_Geometric(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        int failures = 0;
+        while (randomFloat() >= 0.01f) {
+            ++failures;
+        }
+        benchmark::DoNotOptimize(failures);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_BernoulliLoop_Geometric);
+
+static void BM_RandomGeometric(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(randomGeometric(0.01));
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomGeometric);
+
+// Benchmarks for visiting a range in random order
+static void BM_ShuffleVector_Permutation(benchmark::State& state)
+{
+    const std::size_t size = static_cast<std::size_t>(state.range(0));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::vector<std::uint64_t> order(size);
+        std::iota(order.begin(), order.end(), 0);
+        std::shuffle(order.begin(), order.end(), getRandomEngine());
+        benchmark::DoNotOptimize(order.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_ShuffleVector_Permutation)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_RandomPermutation_Scalar(benchmark::State& state)
+{
+    const std::uint64_t size = static_cast<std::uint64_t>(state.range(0));
+    const RandomPermutation permutation(size);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (std::uint64_t i = 0; i < size; ++i) {
+            benchmark::DoNotOptimize(permutation.permute(i));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomPermutation_Scalar)->Arg(1 << 16)->Arg(1 << 20);
+
+static void BM_RandomPermutation_Batch(benchmark::State& state)
+{
+    const std::uint64_t size = static_cast<std::uint64_t>(state.range(0));
+    const RandomPermutation permutation(size);
+    std::vector<std::uint64_t> indices(1024);
+    std::vector<std::uint64_t> results(indices.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (std::uint64_t start = 0; start < size; start += indices.size()) {
+            std::iota(indices.begin(), indices.end(), start);
+            permutation.permute(indices.data(), results.data(), indices.size());
+            benchmark::DoNotOptimize(results.data());
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_RandomPermutation_Batch)->Arg(1 << 16)->Arg(1 << 20);
+
+// Handing out 1000 unique random ids from [0, 100000)
+static void BM_UniqueIds_RandomIntNotInBlacklist(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::vector<int> used;
+        for (int i = 0; i < 1000; ++i) {
+            used.push_back(randomIntNotInBlacklist(used, 0, 100000));
+        }
+        benchmark::DoNotOptimize(used.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_UniqueIds_RandomIntNotInBlacklist);
+
+static void BM_UniqueIds_RandomPermutation(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        const RandomPermutation ids(100000);
+        std::vector<int> used;
+        for (std::uint64_t i = 0; i < 1000; ++i) {
+            used.push_back(static_cast<int>(ids.permute(i)));
+        }
+        benchmark::DoNotOptimize(used.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * 1000);
+}
+BENCHMARK(BM_UniqueIds_RandomPermutation);
+
+// Random identifiers: one randomInt() per char vs whole-word fills
+static void BM_Uuid_RandomIntPerChar(benchmark::State& state)
+{
+    static const char hexDigits[] = "0123456789abcdef";
+    char uuid[uuidLength];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < uuidLength; ++i) {
+            uuid[i] = hexDigits[randomInt(0, 15)];
+        }
+        uuid[8] = uuid[13] = uuid[18] = uuid[23] = '-';
+        uuid[14] = '4';
+        uuid[19] = hexDigits[8 + randomInt(0, 3)];
+        benchmark::DoNotOptimize(uuid);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Uuid_RandomIntPerChar);
+
+static void BM_RandomUuid(benchmark::State& state)
+{
+    char uuid[uuidLength];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomUuid(uuid);
+        benchmark::DoNotOptimize(uuid);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomUuid);
+
+static void BM_RandomUuidBatch(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<char> uuids(count * uuidLength);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomUuidBatch(uuids.data(), count);
+        benchmark::DoNotOptimize(uuids.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_RandomUuidBatch)->Arg(4096);
+
+static void BM_RandomUuidBatch_Os(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<char> uuids(count * uuidLength);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomUuidBatch(uuids.data(), count, IdEntropy::Os);
+        benchmark::DoNotOptimize(uuids.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_RandomUuidBatch_Os)->Arg(4096);
+
+static void BM_Token22_RandomIntPerChar(benchmark::State& state)
+{
+    static const char alphabet[] = "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz";
+    char token[22];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (char& c : token) {
+            c = alphabet[randomInt(0, 61)];
+        }
+        benchmark::DoNotOptimize(token);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_Token22_RandomIntPerChar);
+
+static void BM_RandomToken22(benchmark::State& state)
+{
+    char token[22];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomToken(token, sizeof(token));
+        benchmark::DoNotOptimize(token);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomToken22);
+
+static void BM_RandomToken22_Os(benchmark::State& state)
+{
+    char token[22];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomToken(token, sizeof(token), IdEntropy::Os);
+        benchmark::DoNotOptimize(token);
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_RandomToken22_Os);
+
+static void BM_RandomTokenBatch22(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<char> tokens(count * 22);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomTokenBatch(tokens.data(), count, 22);
+        benchmark::DoNotOptimize(tokens.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_RandomTokenBatch22)->Arg(4096);
+
+static void BM_RandomId128Batch(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    std::vector<Id128> ids(count);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        randomId128Batch(ids.data(), count);
+        benchmark::DoNotOptimize(ids.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * static_cast<std::int64_t>(count));
+}
+BENCHMARK(BM_RandomId128Batch)->Arg(4096);
+
+// Seed-derived tables at worker startup: regenerate in every process vs open a shared mapping
+static void BM_RandomTables_Regenerate(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::vector<std::uint64_t> words(count);
+        std::mt19937_64 engine(12345);
+        for (std::uint64_t& word : words) {
+            word = engine();
+        }
+        benchmark::DoNotOptimize(words.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(std::uint64_t)));
+}
+BENCHMARK(BM_RandomTables_Regenerate)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void BM_RandomTables_OpenMapped(benchmark::State& state)
+{
+    const std::string path = "stevensMathLib_benchmark.tables";
+    RandomTableBuilder(12345).addRandomWords("words", static_cast<std::size_t>(state.range(0))).write(path);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        const RandomTables tables(path, 12345);
+        benchmark::DoNotOptimize(tables.randomWords("words")[0]);
+    }
+
+    std::remove(path.c_str());
+    state.SetBytesProcessed(state.iterations() * state.range(0) * static_cast<std::int64_t>(sizeof(std::uint64_t)));
+}
+BENCHMARK(BM_RandomTables_OpenMapped)->Arg(1 << 22)->Unit(benchmark::kMillisecond);
+
+static void BM_AliasTableView_TableEngine(benchmark::State& state)
+{
+    const std::string path = "stevensMathLib_benchmark.tables";
+    std::vector<double> weights(static_cast<std::size_t>(state.range(0)));
+    for (std::size_t i = 0; i < weights.size(); ++i) {
+        weights[i] = 1.0 + static_cast<double>(i % 13);
+    }
+    RandomTableBuilder(12345).addAliasTable("loot", weights).addRandomWords("words", 1 << 16).write(path);
+    const RandomTables tables(path, 12345);
+    const AliasTableView view = tables.aliasTable("loot");
+    TableEngine engine = tables.randomWords("words").engine();
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(view.sample(engine));
+    }
+
+    std::remove(path.c_str());
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_AliasTableView_TableEngine)->Arg(1000);
+
+// Bulk generation throughput in bytes/s: one engine call per value vs multi-lane
+static void BM_Bulk_Mt19937_Uint64(benchmark::State& state)
+{
+    auto& engine = getRandomEngine();
+    std::vector<std::uint64_t> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (auto& value : values) {
+            value = (static_cast<std::uint64_t>(engine()) << 32) | engine();
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(std::uint64_t));
+}
+BENCHMARK(BM_Bulk_Mt19937_Uint64)->Arg(1 << 16);
+
+template <std::size_t Lanes>
+static void BM_MultiLaneEngine_Fill(benchmark::State& state)
+{
+    MultiLaneEngine<Lanes> engine;
+    std::vector<std::uint64_t> values(static_cast<std::size_t>(state.range(0)));
+    state.SetLabel(MultiLaneEngine<Lanes>::activeKernel());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        engine.fill(values.data(), values.size());
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(std::uint64_t));
+}
+BENCHMARK_TEMPLATE(BM_MultiLaneEngine_Fill, 1)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_MultiLaneEngine_Fill, 4)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_MultiLaneEngine_Fill, 8)->Arg(1 << 16);
+BENCHMARK_TEMPLATE(BM_MultiLaneEngine_Fill, 16)->Arg(1 << 16);
+
+static void BM_Bulk_RandomFloat(benchmark::State& state)
+{
+    std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (auto& value : values) {
+            value = randomFloat(-1.0f, 1.0f);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+BENCHMARK(BM_Bulk_RandomFloat)->Arg(1 << 16);
+
+static void BM_MultiLaneEngine_FillFloats(benchmark::State& state)
+{
+    MultiLaneEngine<8> engine;
+    std::vector<float> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        engine.fillFloats(values.data(), values.size(), -1.0f, 1.0f);
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(float));
+}
+BENCHMARK(BM_MultiLaneEngine_FillFloats)->Arg(1 << 16);
+
+static void BM_Bulk_RandomInt(benchmark::State& state)
+{
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (auto& value : values) {
+            value = randomInt(0, 1000);
+        }
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_Bulk_RandomInt)->Arg(1 << 16);
+
+static void BM_MultiLaneEngine_FillInts(benchmark::State& state)
+{
+    MultiLaneEngine<8> engine;
+    std::vector<int> values(static_cast<std::size_t>(state.range(0)));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        engine.fillInts(values.data(), values.size(), 0, 1000);
+        benchmark::DoNotOptimize(values.data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * state.range(0) * sizeof(int));
+}
+BENCHMARK(BM_MultiLaneEngine_FillInts)->Arg(1 << 16);
+
+// Generate, round, filter and convert: eager temporaries vs a fused stream
+static void BM_Pipeline_EagerVectors(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        std::vector<float> generated(count);
+        for (float& value : generated) {
+            value = randomFloat(0.0f, 100.0f);
+        }
+
+        std::vector<float> roundedValues(count);
+        for (std::size_t i = 0; i < count; ++i) {
+            roundedValues[i] = round(generated[i], 1);
+        }
+
+        std::vector<float> filtered;
+        for (float value : roundedValues) {
+            if (in_range(value, 20.0f, 80.0f)) {
+                filtered.push_back(value);
+            }
+        }
+
+        std::vector<int> converted;
+        converted.reserve(filtered.size());
+        for (float value : filtered) {
+            converted.push_back(floatToInt(value));
+        }
+        benchmark::DoNotOptimize(converted.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Pipeline_EagerVectors)->Arg(1 << 16);
+
+static void BM_Pipeline_FusedStream(benchmark::State& state)
+{
+    const std::size_t count = static_cast<std::size_t>(state.range(0));
+    // The filter keeps ~60% of values, so produce as many outputs as the eager version
+    std::vector<int> results(count * 6 / 10);
+    auto stream = randomFloats(0.0f, 100.0f) | rounded(1) | keepInRange(20.0f, 80.0f) | asInt();
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        stream.fill(results.data(), results.size());
+        benchmark::DoNotOptimize(results.data());
+    }
+
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+BENCHMARK(BM_Pipeline_FusedStream)->Arg(1 << 16);
+
+// Benchmark comparing getRandomEngine vs seedRNG
+static void BM_GetRandomEngine(benchmark::State& state)
+{
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        auto& engine = getRandomEngine();
+        benchmark::DoNotOptimize(engine());
+    }
+
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(BM_GetRandomEngine);
+
+// Tail latency benchmarks: time every draw individually and report percentiles.
+// Clock overhead is included in every sample, so compare percentiles across
+// benchmarks rather than reading them as absolute costs.
+static constexpr std::size_t maxLatencySamples = 1 << 20;
+
+static void noIdleWork() {}
+
+template <typename DrawFunction, typename IdleFunction = void (*)()>
+static void measureDrawLatency(benchmark::State& state, DrawFunction&& draw,
+                               IdleFunction&& idle = noIdleWork)
+{
+    std::vector<double> samples;
+    samples.reserve(maxLatencySamples);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        const auto start = std::chrono::steady_clock::now();
+        benchmark::DoNotOptimize(draw());
+        const auto stop = std::chrono::steady_clock::now();
+
+        if (samples.size() < maxLatencySamples) {
+            samples.push_back(std::chrono::duration<double, std::nano>(stop - start).count());
+        }
+        idle();
+    }
+
+    std::sort(samples.begin(), samples.end());
+    auto percentile = [&samples](double fraction) {
+        return samples[static_cast<std::size_t>(fraction * (samples.size() - 1))];
+    };
+    state.counters["p50_ns"] = percentile(0.5);
+    state.counters["p99_ns"] = percentile(0.99);
+    state.counters["p999_ns"] = percentile(0.999);
+    state.counters["max_ns"] = samples.back();
+    state.SetItemsProcessed(state.iterations());
+}
+
+static void BM_RandomInt_TailLatency(benchmark::State& state)
+{
+    measureDrawLatency(state, [] { return randomInt(0, 1000); });
+}
+BENCHMARK(BM_RandomInt_TailLatency);
+
+static void BM_RandomPool_BackgroundRefill_TailLatency(benchmark::State& state)
+{
+    RandomPool pool;
+    pool.startBackgroundRefill();
+    while (pool.available() < pool.capacity()) {
+        std::this_thread::yield();
+    }
+
+    measureDrawLatency(state, [&pool] { return pool.nextInt(0, 1000); });
+
+    pool.stopBackgroundRefill();
+    state.counters["fallbacks"] = static_cast<double>(pool.fallbackCount());
+}
+BENCHMARK(BM_RandomPool_BackgroundRefill_TailLatency);
+
+static void BM_RandomPool_IdleRefill_TailLatency(benchmark::State& state)
+{
+    // Simulates a handler that tops the pool up between requests
+    RandomPool pool;
+    pool.refill();
+
+    measureDrawLatency(state, [&pool] { return pool.nextInt(0, 1000); },
+                       [&pool] {
+                           if (pool.available() < pool.capacity() / 2) {
+                               pool.refill();
+                           }
+                       });
+
+    state.counters["fallbacks"] = static_cast<double>(pool.fallbackCount());
+}
+BENCHMARK(BM_RandomPool_IdleRefill_TailLatency);
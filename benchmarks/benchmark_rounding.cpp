@@ -5,11 +5,14 @@
  */
 
 #include "../stevensMathLib.h"
+#include "perf_counters.h"
 #include <benchmark/benchmark.h>
 #include <vector>
 #include <random>
+#include <string>
 
 using namespace stevensMathLib;
+using perfCounters::PerfCounterScope;
 
 // Benchmark data generation
 static std::vector<float> generateTestData(size_t size)
@@ -33,6 +36,7 @@ static void BM_IsWholeNumber(benchmark::State& state)
 {
     auto testData = generateTestData(1000);
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : testData) {
             benchmark::DoNotOptimize(isWholeNumber(value));
@@ -48,6 +52,7 @@ static void BM_RoundToNearest10th(benchmark::State& state)
 {
     auto testData = generateTestData(1000);
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : testData) {
             benchmark::DoNotOptimize(roundToNearest10th(value));
@@ -63,6 +68,7 @@ static void BM_Round_Precision1(benchmark::State& state)
 {
     auto testData = generateTestData(1000);
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : testData) {
             benchmark::DoNotOptimize(round(value, 1));
@@ -77,6 +83,7 @@ static void BM_Round_Precision2(benchmark::State& state)
 {
     auto testData = generateTestData(1000);
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : testData) {
             benchmark::DoNotOptimize(round(value, 2));
@@ -91,6 +98,7 @@ static void BM_Round_Precision5(benchmark::State& state)
 {
     auto testData = generateTestData(1000);
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : testData) {
             benchmark::DoNotOptimize(round(value, 5));
@@ -106,6 +114,7 @@ static void BM_FloatToInt_Float(benchmark::State& state)
 {
     auto testData = generateTestData(1000);
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : testData) {
             benchmark::DoNotOptimize(floatToInt(value));
@@ -121,6 +130,7 @@ static void BM_FloatToInt_Double(benchmark::State& state)
     auto testData = generateTestData(1000);
     std::vector<double> doubleData(testData.begin(), testData.end());
 
+    PerfCounterScope perfCounters(state);
     for (auto _ : state) {
         for (const auto& value : doubleData) {
             benchmark::DoNotOptimize(floatToInt(value));
@@ -130,3 +140,253 @@ static void BM_FloatToInt_Double(benchmark::State& state)
     state.SetItemsProcessed(state.iterations() * doubleData.size());
 }
 BENCHMARK(BM_FloatToInt_Double);
+
+// Benchmarks for Decimal fixed-point arithmetic
+static void BM_Decimal_FromFloat(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (const auto& value : testData) {
+            benchmark::DoNotOptimize(Decimal<2>::fromFloat(value));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_Decimal_FromFloat);
+
+static void BM_Decimal_Accumulate(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+    std::vector<Decimal<2>> decimals;
+    for (const auto& value : testData) {
+        decimals.push_back(Decimal<2>::fromFloat(value));
+    }
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        Decimal<2> total;
+        for (const auto& value : decimals) {
+            total += value;
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * decimals.size());
+}
+BENCHMARK(BM_Decimal_Accumulate);
+
+static void BM_Round_RepeatedAccumulate(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        float total = 0.0f;
+        for (const auto& value : testData) {
+            total = round(total + round(value, 2), 2);
+        }
+        benchmark::DoNotOptimize(total);
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_Round_RepeatedAccumulate);
+
+static void BM_Decimal_Multiply(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+    std::vector<Decimal<2>> decimals;
+    for (const auto& value : testData) {
+        decimals.push_back(Decimal<2>::fromFloat(value));
+    }
+    const Decimal<2> rate = Decimal<2>::fromFloat(1.07);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (const auto& value : decimals) {
+            benchmark::DoNotOptimize(value * rate);
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * decimals.size());
+}
+BENCHMARK(BM_Decimal_Multiply);
+
+// Benchmarks for formatting rounded values
+static void BM_FormatNearest10th_ToString(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (const auto& value : testData) {
+            benchmark::DoNotOptimize(std::to_string(roundToNearest10th(value)));
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_FormatNearest10th_ToString);
+
+static void BM_FormatNearest10th(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+    char buffer[32];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (const auto& value : testData) {
+            benchmark::DoNotOptimize(formatNearest10th(buffer, sizeof(buffer), value));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_FormatNearest10th);
+
+static void BM_FormatRounded_Precision2(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+    char buffer[32];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (const auto& value : testData) {
+            benchmark::DoNotOptimize(formatRounded(buffer, sizeof(buffer), value, 2));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_FormatRounded_Precision2);
+
+static void BM_FormatRoundedTrimmed_Precision2(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+    char buffer[32];
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (const auto& value : testData) {
+            benchmark::DoNotOptimize(formatRoundedTrimmed(buffer, sizeof(buffer), value, 2));
+            benchmark::ClobberMemory();
+        }
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_FormatRoundedTrimmed_Precision2);
+
+static void BM_FormatRoundedBatch(benchmark::State& state)
+{
+    auto testData = generateTestData(1000);
+    std::vector<char> buffer(testData.size() * 16);
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        auto result = formatRoundedBatch(testData.data(), testData.size(), 2,
+                                         buffer.data(), buffer.size());
+        benchmark::DoNotOptimize(result);
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_FormatRoundedBatch);
+
+// Benchmarks for half-precision quantization
+static void BM_ToFloat16_ScalarLoop(benchmark::State& state)
+{
+    auto testData = generateTestData(4096);
+    std::vector<Float16> halves(testData.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        for (std::size_t i = 0; i < testData.size(); ++i) {
+            halves[i] = toFloat16(testData[i]);
+        }
+        benchmark::DoNotOptimize(halves.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_ToFloat16_ScalarLoop);
+
+static void BM_ToFloat16Batch(benchmark::State& state)
+{
+    const auto rounding = static_cast<HalfRounding>(state.range(0));
+    auto testData = generateTestData(4096);
+    std::vector<Float16> halves(testData.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        toFloat16Batch(testData.data(), halves.data(), testData.size(), rounding);
+        benchmark::DoNotOptimize(halves.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+    state.SetBytesProcessed(state.iterations() * testData.size() * sizeof(float));
+}
+// 0 = NearestEven, 1 = TowardZero, 2 = Stochastic
+BENCHMARK(BM_ToFloat16Batch)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_ToBFloat16Batch(benchmark::State& state)
+{
+    const auto rounding = static_cast<HalfRounding>(state.range(0));
+    auto testData = generateTestData(4096);
+    std::vector<BFloat16> halves(testData.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        toBFloat16Batch(testData.data(), halves.data(), testData.size(), rounding);
+        benchmark::DoNotOptimize(halves.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+    state.SetBytesProcessed(state.iterations() * testData.size() * sizeof(float));
+}
+BENCHMARK(BM_ToBFloat16Batch)->Arg(0)->Arg(1)->Arg(2);
+
+static void BM_Float16ToFloatBatch(benchmark::State& state)
+{
+    auto testData = generateTestData(4096);
+    std::vector<Float16> halves(testData.size());
+    toFloat16Batch(testData.data(), halves.data(), testData.size());
+    std::vector<float> widened(testData.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        toFloatBatch(halves.data(), widened.data(), halves.size());
+        benchmark::DoNotOptimize(widened.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_Float16ToFloatBatch);
+
+static void BM_BFloat16ToFloatBatch(benchmark::State& state)
+{
+    auto testData = generateTestData(4096);
+    std::vector<BFloat16> halves(testData.size());
+    toBFloat16Batch(testData.data(), halves.data(), testData.size());
+    std::vector<float> widened(testData.size());
+
+    PerfCounterScope perfCounters(state);
+    for (auto _ : state) {
+        toFloatBatch(halves.data(), widened.data(), halves.size());
+        benchmark::DoNotOptimize(widened.data());
+        benchmark::ClobberMemory();
+    }
+
+    state.SetItemsProcessed(state.iterations() * testData.size());
+}
+BENCHMARK(BM_BFloat16ToFloatBatch);
@@ -0,0 +1,77 @@
+#!/usr/bin/env sh
+#
+# header_cost.sh
+#
+# Compile-time and startup-time cost of including stevensMathLib.
+#
+# For each variant below, a translation unit that only includes the header is
+# compiled RUNS times (mean wall time reported), then TUS such translation
+# units are linked into one program whose startup time and static
+# initializer count (.init_array entries) are measured. The "legacy" variant
+# adds <iostream> to the umbrella header, which is what every includer paid
+# before the header was split into modules.
+#
+# Usage: benchmarks/header_cost.sh [runs] [tus]
+#   CXX       compiler to use (default: c++)
+#   CXXFLAGS  extra flags (default: -std=c++17 -O2)
+
+set -eu
+
+RUNS=${1:-10}
+TUS=${2:-20}
+CXX=${CXX:-c++}
+CXXFLAGS=${CXXFLAGS:--std=c++17 -O2}
+ROOT=$(cd "$(dirname "$0")/.." && pwd)
+WORK=$(mktemp -d)
+trap 'rm -rf "$WORK"' EXIT
+
+now_ns() { date +%s%N; }
+
+measure() {
+    name=$1
+    includes=$2
+
+    : > "$WORK/$name.cpp"
+    for header in $includes; do
+        echo "#include $header" >> "$WORK/$name.cpp"
+    done
+
+    start=$(now_ns)
+    i=0
+    while [ "$i" -lt "$RUNS" ]; do
+        $CXX $CXXFLAGS -I"$ROOT" -c "$WORK/$name.cpp" -o "$WORK/$name.o"
+        i=$((i + 1))
+    done
+    compile_ms=$(( ($(now_ns) - start) / RUNS / 1000000 ))
+
+    objects=""
+    i=0
+    while [ "$i" -lt "$TUS" ]; do
+        cp "$WORK/$name.o" "$WORK/$name.$i.o"
+        objects="$objects $WORK/$name.$i.o"
+        i=$((i + 1))
+    done
+    echo 'int main() { return 0; }' > "$WORK/main.cpp"
+    $CXX $CXXFLAGS "$WORK/main.cpp" $objects -o "$WORK/$name.bin" -lpthread
+
+    init_bytes=$(objdump -h "$WORK/$name.bin" | awk '$2 == ".init_array" { print $3 }')
+    initializers=$(( 0x${init_bytes:-0} / 8 ))
+
+    start=$(now_ns)
+    i=0
+    while [ "$i" -lt 200 ]; do
+        "$WORK/$name.bin"
+        i=$((i + 1))
+    done
+    startup_us=$(( ($(now_ns) - start) / 200 / 1000 ))
+
+    printf '%-12s %12s %14s %16s\n' "$name" "$compile_ms" "$startup_us" "$initializers"
+}
+
+printf '%-12s %12s %14s %16s\n' "variant" "compile ms" "startup us" "static inits"
+measure empty       ''
+measure rounding    '"stevensMathLib/rounding.h"'
+measure range       '"stevensMathLib/range.h"'
+measure random      '"stevensMathLib/random.h"'
+measure umbrella    '"stevensMathLib.h"'
+measure legacy      '<iostream> "stevensMathLib.h"'
@@ -0,0 +1,275 @@
+/**
+ * perf_counters.h
+ *
+ * Optional Linux hardware performance counters for the benchmark suite
+ *
+ * Counters are off unless the benchmarks are run with --perf_counters or with
+ * STEVENSMATHLIB_PERF_COUNTERS=1 in the environment. Each benchmark opens a
+ * PerfCounterScope right before its timing loop; when counters are enabled the
+ * scope attaches per-iteration user counters (cycles, instructions, IPC,
+ * branch_misses, l1d_misses, llc_misses) plus cycles_per_item to the run, so
+ * they show up in console, JSON and CSV output alike.
+ *
+ * perf_event_open is often unavailable: non-Linux systems, containers without
+ * CAP_PERFMON, VMs without a virtual PMU, or perf_event_paranoid > 2. Each
+ * event is opened on its own, so a missing event only drops its own counter,
+ * and when none can be opened every scope is a no-op and the suite runs as
+ * usual.
+ *
+ * Only the calling thread is counted (no inherit), which matches the suite:
+ * every benchmark runs its timing loop on the main thread.
+ */
+
+#pragma once
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+#if defined(__linux__)
+#include <cerrno>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+#endif
+
+namespace perfCounters
+{
+    enum Event
+    {
+        Cycles,
+        Instructions,
+        BranchMisses,
+        L1dMisses,
+        LlcMisses,
+        EventCount
+    };
+
+    /**
+     * @brief User counter names, indexed by Event
+     */
+    inline const char* eventName(int event)
+    {
+        static const char* const names[EventCount] = {
+            "cycles", "instructions", "branch_misses", "l1d_misses", "llc_misses"};
+        return names[event];
+    }
+
+    /**
+     * @brief Counter deltas over one measured region; missing events are negative
+     */
+    struct Reading
+    {
+        double values[EventCount] = {-1.0, -1.0, -1.0, -1.0, -1.0};
+
+        bool has(Event event) const { return values[event] >= 0.0; }
+    };
+
+    /**
+     * @brief Process-wide set of perf_event file descriptors, opened once
+     */
+    class CounterSet
+    {
+    public:
+        static CounterSet& instance()
+        {
+            static CounterSet counters;
+            return counters;
+        }
+
+        /**
+         * @brief Opens the events; returns false (see unavailableReason()) if none opened
+         */
+        bool enable()
+        {
+            if (enabled_) {
+                return available();
+            }
+            enabled_ = true;
+#if defined(__linux__)
+            const std::uint64_t l1dReadMiss = PERF_COUNT_HW_CACHE_L1D
+                | (PERF_COUNT_HW_CACHE_OP_READ << 8)
+                | (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+            const std::uint32_t types[EventCount] = {
+                PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE, PERF_TYPE_HARDWARE,
+                PERF_TYPE_HW_CACHE, PERF_TYPE_HARDWARE};
+            const std::uint64_t configs[EventCount] = {
+                PERF_COUNT_HW_CPU_CYCLES, PERF_COUNT_HW_INSTRUCTIONS,
+                PERF_COUNT_HW_BRANCH_MISSES, l1dReadMiss, PERF_COUNT_HW_CACHE_MISSES};
+
+            int firstError = 0;
+            for (int event = 0; event < EventCount; ++event) {
+                fds_[event] = openEvent(types[event], configs[event]);
+                if (fds_[event] >= 0) {
+                    ++openCount_;
+                } else if (firstError == 0) {
+                    firstError = errno;
+                }
+            }
+            if (openCount_ == 0) {
+                reason_ = std::string("perf_event_open failed: ") + std::strerror(firstError);
+            }
+#else
+            reason_ = "perf_event_open is only available on Linux";
+#endif
+            return available();
+        }
+
+        bool enabled() const { return enabled_; }
+        bool available() const { return openCount_ > 0; }
+        const std::string& unavailableReason() const { return reason_; }
+
+        void start()
+        {
+#if defined(__linux__)
+            for (int event = 0; event < EventCount; ++event) {
+                if (fds_[event] >= 0) {
+                    ioctl(fds_[event], PERF_EVENT_IOC_RESET, 0);
+                    ioctl(fds_[event], PERF_EVENT_IOC_ENABLE, 0);
+                }
+            }
+#endif
+        }
+
+        Reading stop()
+        {
+            Reading reading;
+#if defined(__linux__)
+            for (int event = 0; event < EventCount; ++event) {
+                if (fds_[event] >= 0) {
+                    ioctl(fds_[event], PERF_EVENT_IOC_DISABLE, 0);
+                }
+            }
+            for (int event = 0; event < EventCount; ++event) {
+                // value, time enabled, time running: scale up if the PMU multiplexed us
+                std::uint64_t data[3] = {};
+                if (fds_[event] < 0 || read(fds_[event], data, sizeof(data)) != sizeof(data)
+                    || data[2] == 0) {
+                    continue;
+                }
+                reading.values[event] = static_cast<double>(data[0])
+                    * (static_cast<double>(data[1]) / static_cast<double>(data[2]));
+            }
+#endif
+            return reading;
+        }
+
+        CounterSet(const CounterSet&) = delete;
+        CounterSet& operator=(const CounterSet&) = delete;
+
+    private:
+        CounterSet() = default;
+
+        ~CounterSet()
+        {
+#if defined(__linux__)
+            for (int fd : fds_) {
+                if (fd >= 0) {
+                    close(fd);
+                }
+            }
+#endif
+        }
+
+#if defined(__linux__)
+        static int openEvent(std::uint32_t type, std::uint64_t config)
+        {
+            perf_event_attr attributes;
+            std::memset(&attributes, 0, sizeof(attributes));
+            attributes.size = sizeof(attributes);
+            attributes.type = type;
+            attributes.config = config;
+            attributes.disabled = 1;
+            attributes.exclude_kernel = 1;
+            attributes.exclude_hv = 1;
+            attributes.read_format = PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+            return static_cast<int>(syscall(SYS_perf_event_open, &attributes, 0, -1, -1, 0));
+        }
+#endif
+
+        int fds_[EventCount] = {-1, -1, -1, -1, -1};
+        int openCount_ = 0;
+        bool enabled_ = false;
+        std::string reason_ = "perf counters not enabled";
+    };
+
+    /**
+     * @brief True if --perf_counters was given or STEVENSMATHLIB_PERF_COUNTERS is set to non-zero
+     *
+     * Removes --perf_counters from argv so Google Benchmark does not reject it.
+     */
+    inline bool requestedOnCommandLine(int* argc, char** argv)
+    {
+        bool requested = false;
+        int kept = 1;
+        for (int i = 1; i < *argc; ++i) {
+            if (std::strcmp(argv[i], "--perf_counters") == 0) {
+                requested = true;
+            } else {
+                argv[kept++] = argv[i];
+            }
+        }
+        *argc = kept;
+
+        const char* environment = std::getenv("STEVENSMATHLIB_PERF_COUNTERS");
+        return requested || (environment != nullptr && *environment != '\0' && std::strcmp(environment, "0") != 0);
+    }
+
+    /**
+     * @brief Counts the enclosing benchmark's timing loop and attaches the results
+     *
+     * Construct immediately before `for (auto _ : state)`; the counters are read
+     * when the scope ends, after SetItemsProcessed(), so cycles_per_item uses the
+     * benchmark's own item count (or iterations if it does not report items).
+     *
+     * Example:
+     *   PerfCounterScope perfCounters(state);
+     *   for (auto _ : state) { ... }
+     *   state.SetItemsProcessed(state.iterations() * size);
+     */
+    class PerfCounterScope
+    {
+    public:
+        explicit PerfCounterScope(benchmark::State& state)
+            : state_(state), active_(CounterSet::instance().available())
+        {
+            if (active_) {
+                CounterSet::instance().start();
+            }
+        }
+
+        ~PerfCounterScope()
+        {
+            if (!active_ || state_.iterations() == 0) {
+                return;
+            }
+            const Reading reading = CounterSet::instance().stop();
+
+            for (int event = 0; event < EventCount; ++event) {
+                if (reading.has(static_cast<Event>(event))) {
+                    state_.counters[eventName(event)] =
+                        benchmark::Counter(reading.values[event], benchmark::Counter::kAvgIterations);
+                }
+            }
+            if (reading.has(Cycles) && reading.has(Instructions) && reading.values[Cycles] > 0.0) {
+                state_.counters["IPC"] = reading.values[Instructions] / reading.values[Cycles];
+            }
+            if (reading.has(Cycles)) {
+                const std::int64_t items = state_.items_processed() > 0
+                    ? state_.items_processed()
+                    : static_cast<std::int64_t>(state_.iterations());
+                state_.counters["cycles_per_item"] = reading.values[Cycles] / static_cast<double>(items);
+            }
+        }
+
+        PerfCounterScope(const PerfCounterScope&) = delete;
+        PerfCounterScope& operator=(const PerfCounterScope&) = delete;
+
+    private:
+        benchmark::State& state_;
+        bool active_;
+    };
+} // namespace perfCounters
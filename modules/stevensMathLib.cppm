@@ -0,0 +1,159 @@
+/**
+ * stevensMathLib.cppm
+ *
+ * Optional C++20 module interface unit. `import stevensMathLib;` exposes the
+ * same public API as the umbrella header, but the headers are parsed once
+ * when the module is built instead of in every translation unit.
+ *
+ * Built only when STEVENSMATHLIB_BUILD_MODULE is ON (CMake 3.28+ and a
+ * compiler with module dependency scanning). Macros such as
+ * STEVENSMATHLIB_X86_DISPATCH are not exported; include the headers instead
+ * when you need them.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+module;
+
+#include "../stevensMathLib.h"
+
+export module stevensMathLib;
+
+export namespace stevensMathLib
+{
+    // instrumentation.h
+    using stevensMathLib::InstrumentationCounter;
+    using stevensMathLib::InstrumentationSnapshot;
+    using stevensMathLib::instrumentationCounterName;
+    using stevensMathLib::instrumentationEnabled;
+    using stevensMathLib::instrumentationSnapshot;
+
+    // range.h
+    using stevensMathLib::BoundType;
+    using stevensMathLib::in_range;
+
+    // range_math.h
+    using stevensMathLib::activeRangeKernel;
+    using stevensMathLib::clamp;
+    using stevensMathLib::remap;
+    using stevensMathLib::lerp;
+    using stevensMathLib::inverseLerp;
+    using stevensMathLib::smoothstep;
+    using stevensMathLib::clampBatch;
+    using stevensMathLib::remapBatch;
+    using stevensMathLib::lerpBatch;
+    using stevensMathLib::inverseLerpBatch;
+    using stevensMathLib::smoothstepBatch;
+
+    // rounding.h
+    using stevensMathLib::isWholeNumber;
+    using stevensMathLib::roundToNearest10th;
+    using stevensMathLib::round;
+
+    // half.h
+    using stevensMathLib::HalfRounding;
+    using stevensMathLib::Float16;
+    using stevensMathLib::BFloat16;
+    using stevensMathLib::activeHalfKernel;
+    using stevensMathLib::toFloat16;
+    using stevensMathLib::toBFloat16;
+    using stevensMathLib::toFloat;
+    using stevensMathLib::toFloat16Batch;
+    using stevensMathLib::toBFloat16Batch;
+    using stevensMathLib::toFloatBatch;
+
+    // conversion.h
+    using stevensMathLib::floatToInt;
+    using stevensMathLib::floatToInteger;
+
+    // random.h
+    using stevensMathLib::seedRNG;
+    using stevensMathLib::getRandomEngine;
+    using stevensMathLib::getRandomEngine64;
+    using stevensMathLib::setSeed;
+    using stevensMathLib::randomFloat;
+    using stevensMathLib::randomInt;
+    using stevensMathLib::randomBool;
+    using stevensMathLib::randomBernoulli;
+    using stevensMathLib::randomBoolMask;
+    using stevensMathLib::randomBernoulliMask;
+    using stevensMathLib::randomIntNotInBlacklist;
+
+    // random_integral.h
+    using stevensMathLib::randomIntegral;
+    using stevensMathLib::randomBits;
+    using stevensMathLib::randomIntegralBatch;
+    using stevensMathLib::randomBitsBatch;
+
+    // random_pool.h, sampling.h, dice.h
+    using stevensMathLib::RandomPool;
+    using stevensMathLib::ReservoirSampler;
+    using stevensMathLib::WeightedReservoirSampler;
+    using stevensMathLib::AliasTable;
+    using stevensMathLib::DiceRoll;
+
+    // distributions.h
+    using stevensMathLib::BinomialSampler;
+    using stevensMathLib::PoissonSampler;
+    using stevensMathLib::GeometricSampler;
+    using stevensMathLib::randomBinomial;
+    using stevensMathLib::randomPoisson;
+    using stevensMathLib::randomGeometric;
+
+    // permutation.h, multilane.h
+    using stevensMathLib::RandomPermutation;
+    using stevensMathLib::MultiLaneEngine;
+
+    // random_id.h
+    using stevensMathLib::IdEntropy;
+    using stevensMathLib::Id128;
+    using stevensMathLib::uuidLength;
+    using stevensMathLib::randomUuid;
+    using stevensMathLib::randomUuidString;
+    using stevensMathLib::randomUuidBatch;
+    using stevensMathLib::randomToken;
+    using stevensMathLib::randomTokenString;
+    using stevensMathLib::randomTokenBatch;
+    using stevensMathLib::randomId64;
+    using stevensMathLib::randomId64Batch;
+    using stevensMathLib::randomId128;
+    using stevensMathLib::randomId128Batch;
+
+    // random_tables.h
+    using stevensMathLib::randomTableFormatVersion;
+    using stevensMathLib::randomTableAlgorithmVersion;
+    using stevensMathLib::randomTableMaxNameLength;
+    using stevensMathLib::RandomTableKind;
+    using stevensMathLib::TableLoading;
+    using stevensMathLib::TableEngine;
+    using stevensMathLib::RandomWordsView;
+    using stevensMathLib::PermutationTableView;
+    using stevensMathLib::AliasTableView;
+    using stevensMathLib::RandomTableBuilder;
+    using stevensMathLib::RandomTables;
+
+    // random_stream.h
+    using stevensMathLib::RandomStream;
+    using stevensMathLib::randomFloats;
+    using stevensMathLib::randomInts;
+    using stevensMathLib::rounded;
+    using stevensMathLib::keepInRange;
+    using stevensMathLib::asInt;
+    using stevensMathLib::mapValues;
+    using stevensMathLib::operator|;
+
+    // interval.h, quantile.h
+    using stevensMathLib::Interval;
+    using stevensMathLib::IntervalIndex;
+    using stevensMathLib::QuantileSketch;
+
+    // decimal.h, format.h
+    using stevensMathLib::RoundingMode;
+    using stevensMathLib::Decimal;
+    using stevensMathLib::formatRounded;
+    using stevensMathLib::formatRoundedTrimmed;
+    using stevensMathLib::formatNearest10th;
+    using stevensMathLib::FormatBatchResult;
+    using stevensMathLib::formatRoundedBatch;
+} // namespace stevensMathLib
@@ -0,0 +1,765 @@
+/**
+ * random_quality.cpp
+ *
+ * Statistical quality and throughput harness for the generators and
+ * distributions in stevensMathLib. Runs fully offline.
+ *
+ * Usage:
+ *   random_quality                     Run every battery and print the report
+ *   random_quality --only <name>       Run one source
+ *   random_quality --samples <n>       Values per uniform source (default 4194304)
+ *   random_quality --seed <n>          Seed passed to setSeed() (default 20240601)
+ *   random_quality --list              List source names
+ *   random_quality --stream <name>     Write raw little-endian 32-bit words to
+ *                                      stdout forever, e.g. for PractRand:
+ *                                      random_quality --stream engine | RNG_test stdin32
+ *   random_quality --stream-bytes <n>  Stop streaming after n bytes
+ *
+ * Uniform sources produce integers in [0, range) and go through five tests:
+ * chi-square uniformity, gap, runs above/below the midpoint, birthday
+ * spacings and lag-1 serial correlation. Discrete distributions are checked
+ * with a chi-square goodness-of-fit test against their exact probabilities.
+ *
+ * Exits with status 1 if any non-control source fails.
+ */
+
+#include "../stevensMathLib.h"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <memory>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace stevensMathLib;
+
+namespace
+{
+    constexpr double failThreshold = 1e-6;
+    constexpr double suspectThreshold = 1e-3;
+
+    /**
+     * @brief A generator whose output is uniform over [0, range)
+     */
+    struct UniformSource
+    {
+        std::string name;
+        std::uint64_t range;  // At most 2^32
+        std::function<std::uint64_t()> next;
+        bool control = false; // Known-bad generator; failures are expected
+    };
+
+    /**
+     * @brief A discrete distribution with known probabilities
+     */
+    struct DiscreteSource
+    {
+        std::string name;
+        std::function<std::int64_t()> next;
+        std::function<double(std::int64_t)> probability;
+        std::int64_t minimum;
+        std::int64_t maximum;
+    };
+
+    struct TestResult
+    {
+        double pValue = 1.0;
+        bool applicable = true;
+    };
+
+    // -------------------------------------------------------------------------
+    // Special functions
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Regularized upper incomplete gamma function Q(a, x)
+     */
+    double gammaQ(double a, double x)
+    {
+        if (x <= 0.0) {
+            return 1.0;
+        }
+
+        const double logPrefix = -x + a * std::log(x) - std::lgamma(a);
+
+        if (x < a + 1.0) {
+            // Series for P(a, x)
+            double term = 1.0 / a;
+            double sum = term;
+            for (int n = 1; n < 10000; ++n) {
+                term *= x / (a + n);
+                sum += term;
+                if (std::abs(term) < std::abs(sum) * 1e-15) {
+                    break;
+                }
+            }
+            return std::max(0.0, 1.0 - sum * std::exp(logPrefix));
+        }
+
+        // Lentz continued fraction for Q(a, x)
+        const double tiny = 1e-300;
+        double b = x + 1.0 - a;
+        double c = 1.0 / tiny;
+        double d = 1.0 / b;
+        double h = d;
+        for (int n = 1; n < 10000; ++n) {
+            const double an = -n * (n - a);
+            b += 2.0;
+            d = an * d + b;
+            d = std::abs(d) < tiny ? tiny : d;
+            c = b + an / c;
+            c = std::abs(c) < tiny ? tiny : c;
+            d = 1.0 / d;
+            const double delta = d * c;
+            h *= delta;
+            if (std::abs(delta - 1.0) < 1e-15) {
+                break;
+            }
+        }
+        return std::exp(logPrefix) * h;
+    }
+
+    double chiSquarePValue(double statistic, int degreesOfFreedom)
+    {
+        return gammaQ(degreesOfFreedom / 2.0, statistic / 2.0);
+    }
+
+    double twoSidedNormalPValue(double z)
+    {
+        return std::erfc(std::abs(z) / std::sqrt(2.0));
+    }
+
+    /**
+     * @brief Chi-square statistic over categories with at least 5 expected hits
+     *
+     * Adjacent sparse categories are pooled so the approximation holds.
+     */
+    TestResult chiSquareTest(const std::vector<double>& observed, const std::vector<double>& expected)
+    {
+        double statistic = 0.0;
+        int categories = 0;
+        double pooledObserved = 0.0;
+        double pooledExpected = 0.0;
+
+        for (std::size_t i = 0; i < observed.size(); ++i) {
+            pooledObserved += observed[i];
+            pooledExpected += expected[i];
+            if (pooledExpected >= 5.0) {
+                const double difference = pooledObserved - pooledExpected;
+                statistic += difference * difference / pooledExpected;
+                ++categories;
+                pooledObserved = 0.0;
+                pooledExpected = 0.0;
+            }
+        }
+        if (pooledExpected > 0.0) {
+            const double difference = pooledObserved - pooledExpected;
+            statistic += difference * difference / std::max(pooledExpected, 1e-12);
+            ++categories;
+        }
+
+        if (categories < 2) {
+            return {1.0, false};
+        }
+        return {chiSquarePValue(statistic, categories - 1), true};
+    }
+
+    // -------------------------------------------------------------------------
+    // Uniform tests
+    // -------------------------------------------------------------------------
+
+    TestResult uniformityTest(const std::vector<std::uint64_t>& values, std::uint64_t range)
+    {
+        const std::uint64_t bins = std::min<std::uint64_t>(range, 4096);
+        std::vector<double> observed(bins, 0.0);
+        for (std::uint64_t value : values) {
+            observed[value * bins / range] += 1.0;
+        }
+
+        // Exact expected counts even when bins does not divide range
+        std::vector<double> expected(bins);
+        for (std::uint64_t bin = 0; bin < bins; ++bin) {
+            const std::uint64_t first = (bin * range + bins - 1) / bins;
+            const std::uint64_t last = ((bin + 1) * range + bins - 1) / bins;
+            expected[bin] = static_cast<double>(values.size()) * static_cast<double>(last - first) /
+                            static_cast<double>(range);
+        }
+        return chiSquareTest(observed, expected);
+    }
+
+    /**
+     * @brief Knuth's gap test: lengths between visits to [1/4, 3/8)
+     */
+    TestResult gapTest(const std::vector<std::uint64_t>& values, std::uint64_t range)
+    {
+        static constexpr int maxGap = 48;
+
+        const std::uint64_t low = range / 4;
+        const std::uint64_t high = range * 3 / 8;
+        if (high <= low) {
+            return {1.0, false};
+        }
+        const double hitProbability = static_cast<double>(high - low) / static_cast<double>(range);
+
+        std::vector<double> observed(maxGap + 1, 0.0);
+        int gap = 0;
+        bool started = false;
+        for (std::uint64_t value : values) {
+            if (value >= low && value < high) {
+                if (started) {
+                    observed[std::min(gap, maxGap)] += 1.0;
+                }
+                started = true;
+                gap = 0;
+            } else {
+                ++gap;
+            }
+        }
+
+        double gaps = 0.0;
+        for (double count : observed) {
+            gaps += count;
+        }
+
+        std::vector<double> expected(maxGap + 1);
+        for (int length = 0; length < maxGap; ++length) {
+            expected[length] = gaps * hitProbability * std::pow(1.0 - hitProbability, length);
+        }
+        expected[maxGap] = gaps * std::pow(1.0 - hitProbability, maxGap);
+        return chiSquareTest(observed, expected);
+    }
+
+    /**
+     * @brief Wald-Wolfowitz runs of values above and below the midpoint
+     */
+    TestResult runsTest(const std::vector<std::uint64_t>& values, std::uint64_t range)
+    {
+        const std::uint64_t midpoint = range / 2;
+        double above = 0.0;
+        double runs = 0.0;
+        bool previous = false;
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            const bool current = values[i] >= midpoint;
+            above += current;
+            if (i == 0 || current != previous) {
+                runs += 1.0;
+            }
+            previous = current;
+        }
+
+        const double n = static_cast<double>(values.size());
+        const double below = n - above;
+        if (above == 0.0 || below == 0.0) {
+            return {0.0, true};
+        }
+
+        const double mean = 2.0 * above * below / n + 1.0;
+        const double variance = (mean - 1.0) * (mean - 2.0) / (n - 1.0);
+        return {twoSidedNormalPValue((runs - mean) / std::sqrt(variance)), true};
+    }
+
+    /**
+     * @brief Lag-1 serial correlation of the values scaled to [0, 1)
+     */
+    TestResult serialCorrelationTest(const std::vector<std::uint64_t>& values, std::uint64_t range)
+    {
+        const double scale = 1.0 / static_cast<double>(range);
+        double mean = 0.0;
+        for (std::uint64_t value : values) {
+            mean += value * scale;
+        }
+        mean /= static_cast<double>(values.size());
+
+        double covariance = 0.0;
+        double variance = 0.0;
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            const double centered = values[i] * scale - mean;
+            variance += centered * centered;
+            if (i + 1 < values.size()) {
+                covariance += centered * (values[i + 1] * scale - mean);
+            }
+        }
+        if (variance == 0.0) {
+            return {0.0, true};
+        }
+
+        const double correlation = covariance / variance;
+        return {twoSidedNormalPValue(correlation * std::sqrt(static_cast<double>(values.size()))), true};
+    }
+
+    /**
+     * @brief Marsaglia's birthday spacings with 512 birthdays in a 2^24-day year
+     *
+     * Duplicate spacings are Poisson with mean 512^3 / (4 * 2^24) = 2.
+     */
+    TestResult birthdaySpacingsTest(const UniformSource& source)
+    {
+        static constexpr int birthdays = 512;
+        static constexpr int dayBits = 24;
+        static constexpr int repetitions = 1000;
+        static constexpr int maxDuplicates = 8;
+        static constexpr double lambda = 2.0;
+
+        if (source.range < (std::uint64_t{1} << dayBits)) {
+            return {1.0, false};
+        }
+
+        std::vector<double> observed(maxDuplicates + 1, 0.0);
+        std::vector<std::uint64_t> days(birthdays);
+        std::vector<std::uint64_t> spacings(birthdays);
+
+        for (int repetition = 0; repetition < repetitions; ++repetition) {
+            for (std::uint64_t& day : days) {
+                day = (source.next() << dayBits) / source.range;
+            }
+            std::sort(days.begin(), days.end());
+
+            spacings[0] = days[0];
+            for (int i = 1; i < birthdays; ++i) {
+                spacings[i] = days[i] - days[i - 1];
+            }
+            std::sort(spacings.begin(), spacings.end());
+
+            int duplicates = 0;
+            for (int i = 1; i < birthdays; ++i) {
+                duplicates += spacings[i] == spacings[i - 1];
+            }
+            observed[std::min(duplicates, maxDuplicates)] += 1.0;
+        }
+
+        std::vector<double> expected(maxDuplicates + 1);
+        double cumulative = 0.0;
+        double probability = std::exp(-lambda);
+        for (int k = 0; k < maxDuplicates; ++k) {
+            expected[k] = repetitions * probability;
+            cumulative += probability;
+            probability *= lambda / (k + 1);
+        }
+        expected[maxDuplicates] = repetitions * (1.0 - cumulative);
+        return chiSquareTest(observed, expected);
+    }
+
+    // -------------------------------------------------------------------------
+    // Reporting
+    // -------------------------------------------------------------------------
+
+    /**
+     * @brief Classifies a p-value, treating both tails as suspicious
+     */
+    double tailOf(double pValue)
+    {
+        return std::min(pValue, 1.0 - pValue);
+    }
+
+    const char* verdictFor(double pValue)
+    {
+        const double tail = tailOf(pValue);
+        if (tail < failThreshold) {
+            return "FAIL";
+        }
+        if (tail < suspectThreshold) {
+            return "suspect";
+        }
+        return "pass";
+    }
+
+    std::string formatPValue(const TestResult& result)
+    {
+        if (!result.applicable) {
+            return "n/a";
+        }
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.4f", result.pValue);
+        return buffer;
+    }
+
+    template <typename Draw>
+    double measureThroughput(Draw draw)
+    {
+        static constexpr int draws = 1 << 21;
+
+        std::uint64_t sink = 0;
+        const auto start = std::chrono::steady_clock::now();
+        for (int i = 0; i < draws; ++i) {
+            sink += static_cast<std::uint64_t>(draw());
+        }
+        const auto elapsed = std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+        // Keep the loop observable
+        if (sink == 1) {
+            std::fputc(' ', stderr);
+        }
+        return draws / elapsed / 1e6;
+    }
+
+    // -------------------------------------------------------------------------
+    // Sources
+    // -------------------------------------------------------------------------
+
+    /**
+     * @param samples Values each uniform test draws; sizes the TableEngine table
+     *        so the tests never see it wrap around
+     */
+    std::vector<UniformSource> uniformSources(std::size_t samples)
+    {
+        std::vector<UniformSource> sources;
+
+        sources.push_back({"engine", std::uint64_t{1} << 32,
+                           []() { return static_cast<std::uint64_t>(getRandomEngine()()); }});
+
+        sources.push_back({"randomInt(0,1000)", 1000,
+                           []() { return static_cast<std::uint64_t>(randomInt(0, 1000)); }});
+
+        sources.push_back({"randomInt(0,6)", 6,
+                           []() { return static_cast<std::uint64_t>(randomInt(0, 6)); }});
+
+        sources.push_back({"randomInt(0,3e9 span)", 3000000000ull, []() {
+                               return static_cast<std::uint64_t>(
+                                   static_cast<std::int64_t>(randomInt(-1500000000, 1500000000)) + 1500000000);
+                           }});
+
+        sources.push_back({"randomIntegral<int64>(0,1e9)", 1000000000, []() {
+                               return static_cast<std::uint64_t>(randomIntegral<std::int64_t>(0, 999999999));
+                           }});
+
+        // The full 64-bit range takes the no-rejection path
+        sources.push_back({"randomIntegral<uint64> full", std::uint64_t{1} << 32, []() {
+                               return randomIntegral<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max()) >> 32;
+                           }});
+
+        sources.push_back({"randomBits<uint32>", std::uint64_t{1} << 32,
+                           []() { return static_cast<std::uint64_t>(randomBits<std::uint32_t>()); }});
+
+        // randomFloat() returns multiples of 2^-24, so scaling recovers the integer exactly
+        sources.push_back({"randomFloat", std::uint64_t{1} << 24,
+                           []() { return static_cast<std::uint64_t>(randomFloat() * 16777216.0f); }});
+
+        auto pool = std::make_shared<RandomPool>();
+        sources.push_back({"RandomPool", std::uint64_t{1} << 32, [pool]() {
+                               if (pool->available() == 0) {
+                                   pool->refill();
+                               }
+                               return pool->next() >> 32;
+                           }});
+
+        auto permutation = std::make_shared<RandomPermutation>(std::uint64_t{1} << 32);
+        auto counter = std::make_shared<std::uint64_t>(0);
+        sources.push_back({"RandomPermutation(2^32)", std::uint64_t{1} << 32,
+                           [permutation, counter]() { return permutation->permute((*counter)++); }});
+
+        auto multiLane = std::make_shared<MultiLaneEngine<8>>();
+        sources.push_back({"MultiLaneEngine<8>", std::uint64_t{1} << 32,
+                           [multiLane]() { return (*multiLane)() >> 32; }});
+        sources.push_back({"MultiLaneEngine<8> low bits", std::uint64_t{1} << 32,
+                           [multiLane]() { return (*multiLane)() & 0xFFFFFFFFu; }});
+
+        // Generated like a RandomTableBuilder words table, but in memory and only
+        // when the source is first drawn from. Streaming past the end repeats it.
+        const std::size_t tableWords = samples + (std::size_t{1} << 20);
+        const std::uint64_t tableSeed = detail::randomWord64();
+        auto table = std::make_shared<std::vector<std::uint64_t>>();
+        auto tableEngine = std::make_shared<std::unique_ptr<TableEngine>>();
+        sources.push_back({"TableEngine", std::uint64_t{1} << 32, [=]() {
+                               if (!*tableEngine) {
+                                   std::mt19937_64 generator = detail::tableEngine(tableSeed, "quality");
+                                   table->resize(tableWords);
+                                   for (std::uint64_t& word : *table) {
+                                       word = generator();
+                                   }
+                                   *tableEngine = std::make_unique<TableEngine>(table->data(), table->size());
+                               }
+                               return (**tableEngine)() >> 32;
+                           }});
+
+        // Control: the low bits of a power-of-two LCG have tiny periods and must fail
+        auto lcgState = std::make_shared<std::uint32_t>(12345u);
+        sources.push_back({"control: LCG low 8 bits", 256, [lcgState]() {
+                               *lcgState = *lcgState * 1664525u + 1013904223u;
+                               return static_cast<std::uint64_t>(*lcgState & 0xFFu);
+                           }, true});
+
+        return sources;
+    }
+
+    double binomialProbability(int trials, double probability, std::int64_t k)
+    {
+        if (k < 0 || k > trials) {
+            return 0.0;
+        }
+        return std::exp(std::lgamma(trials + 1.0) - std::lgamma(k + 1.0) - std::lgamma(trials - k + 1.0) +
+                        k * std::log(probability) + (trials - k) * std::log1p(-probability));
+    }
+
+    double poissonProbability(double mean, std::int64_t k)
+    {
+        if (k < 0) {
+            return 0.0;
+        }
+        return std::exp(-mean + k * std::log(mean) - std::lgamma(k + 1.0));
+    }
+
+    std::vector<DiscreteSource> discreteSources()
+    {
+        std::vector<DiscreteSource> sources;
+
+        sources.push_back({"randomBinomial(20,0.3)", []() { return static_cast<std::int64_t>(randomBinomial(20, 0.3)); },
+                           [](std::int64_t k) { return binomialProbability(20, 0.3, k); }, 0, 20});
+
+        sources.push_back({"randomBinomial(10000,0.4)",
+                           []() { return static_cast<std::int64_t>(randomBinomial(10000, 0.4)); },
+                           [](std::int64_t k) { return binomialProbability(10000, 0.4, k); }, 3700, 4300});
+
+        sources.push_back({"randomPoisson(3.5)", []() { return randomPoisson(3.5); },
+                           [](std::int64_t k) { return poissonProbability(3.5, k); }, 0, 40});
+
+        sources.push_back({"randomPoisson(1000)", []() { return randomPoisson(1000.0); },
+                           [](std::int64_t k) { return poissonProbability(1000.0, k); }, 850, 1150});
+
+        sources.push_back({"randomBernoulli(0.3)", []() { return static_cast<std::int64_t>(randomBernoulli(0.3)); },
+                           [](std::int64_t k) { return k == 1 ? 0.3 : (k == 0 ? 0.7 : 0.0); }, 0, 1});
+
+        sources.push_back({"randomGeometric(0.2)", []() { return randomGeometric(0.2); },
+                           [](std::int64_t k) { return k < 0 ? 0.0 : 0.2 * std::pow(0.8, static_cast<double>(k)); },
+                           0, 100});
+
+        auto dice = std::make_shared<DiceRoll>("4d6 drop lowest");
+        sources.push_back({"DiceRoll(4d6 drop lowest)", [dice]() { return static_cast<std::int64_t>(dice->roll()); },
+                           [dice](std::int64_t k) { return dice->probabilityOf(static_cast<int>(k)); }, 3, 18});
+
+        return sources;
+    }
+
+    // -------------------------------------------------------------------------
+    // Runners
+    // -------------------------------------------------------------------------
+
+    bool runUniform(const UniformSource& source, std::size_t samples)
+    {
+        std::vector<std::uint64_t> values(samples);
+        for (std::uint64_t& value : values) {
+            value = source.next();
+        }
+
+        const TestResult results[] = {
+            uniformityTest(values, source.range),
+            gapTest(values, source.range),
+            runsTest(values, source.range),
+            birthdaySpacingsTest(source),
+            serialCorrelationTest(values, source.range),
+        };
+        const double throughput = measureThroughput(source.next);
+
+        // The overall verdict follows the most extreme p-value
+        double worstPValue = 0.5;
+        for (const TestResult& result : results) {
+            if (result.applicable && tailOf(result.pValue) < tailOf(worstPValue)) {
+                worstPValue = result.pValue;
+            }
+        }
+        const char* verdict = verdictFor(worstPValue);
+
+        std::printf("%-28s %10s %10s %10s %10s %10s %10.1f   %s\n", source.name.c_str(),
+                    formatPValue(results[0]).c_str(), formatPValue(results[1]).c_str(),
+                    formatPValue(results[2]).c_str(), formatPValue(results[3]).c_str(),
+                    formatPValue(results[4]).c_str(), throughput, verdict);
+
+        return source.control || std::strcmp(verdict, "FAIL") != 0;
+    }
+
+    bool runDiscrete(const DiscreteSource& source, std::size_t samples)
+    {
+        const std::size_t categories = static_cast<std::size_t>(source.maximum - source.minimum + 1);
+        // Two extra categories collect everything below minimum and above maximum
+        std::vector<double> observed(categories + 2, 0.0);
+
+        for (std::size_t i = 0; i < samples; ++i) {
+            const std::int64_t value = source.next();
+            if (value < source.minimum) {
+                observed[0] += 1.0;
+            } else if (value > source.maximum) {
+                observed[categories + 1] += 1.0;
+            } else {
+                observed[static_cast<std::size_t>(value - source.minimum) + 1] += 1.0;
+            }
+        }
+
+        std::vector<double> expected(categories + 2, 0.0);
+        double covered = 0.0;
+        for (std::size_t i = 0; i < categories; ++i) {
+            const double probability = source.probability(source.minimum + static_cast<std::int64_t>(i));
+            expected[i + 1] = samples * probability;
+            covered += probability;
+        }
+        double below = 0.0;
+        for (std::int64_t k = 0; k < source.minimum; ++k) {
+            below += source.probability(k);
+        }
+        expected[0] = samples * below;
+        expected[categories + 1] = samples * std::max(0.0, 1.0 - covered - below);
+
+        const TestResult result = chiSquareTest(observed, expected);
+        const double throughput = measureThroughput(source.next);
+        const char* verdict = verdictFor(result.pValue);
+
+        std::printf("%-28s %10s %10s %10s %10s %10s %10.1f   %s\n", source.name.c_str(),
+                    formatPValue(result).c_str(), "", "", "", "", throughput, verdict);
+
+        return std::strcmp(verdict, "FAIL") != 0;
+    }
+
+    /**
+     * @brief Packs the source's output bits into 32-bit words on stdout
+     *
+     * Only power-of-two ranges carry whole bits, so other sources are refused.
+     */
+    int streamSource(const UniformSource& source, std::uint64_t byteLimit)
+    {
+        int bitsPerValue = 0;
+        while ((std::uint64_t{1} << bitsPerValue) < source.range) {
+            ++bitsPerValue;
+        }
+        if ((std::uint64_t{1} << bitsPerValue) != source.range) {
+            std::fprintf(stderr, "random_quality: %s has a non-power-of-two range and cannot be streamed\n",
+                         source.name.c_str());
+            return 2;
+        }
+
+        static constexpr std::size_t wordsPerBuffer = 16384;
+        std::vector<unsigned char> buffer(wordsPerBuffer * 4);
+        std::uint64_t accumulator = 0;
+        int accumulatedBits = 0;
+        std::uint64_t written = 0;
+
+        while (byteLimit == 0 || written < byteLimit) {
+            for (std::size_t word = 0; word < wordsPerBuffer; ++word) {
+                while (accumulatedBits < 32) {
+                    accumulator |= source.next() << accumulatedBits;
+                    accumulatedBits += bitsPerValue;
+                }
+                const std::uint32_t output = static_cast<std::uint32_t>(accumulator);
+                accumulator = bitsPerValue == 64 ? 0 : accumulator >> 32;
+                accumulatedBits -= 32;
+                for (int byte = 0; byte < 4; ++byte) {
+                    buffer[word * 4 + byte] = static_cast<unsigned char>(output >> (8 * byte));
+                }
+            }
+
+            std::size_t toWrite = buffer.size();
+            if (byteLimit != 0) {
+                toWrite = static_cast<std::size_t>(std::min<std::uint64_t>(toWrite, byteLimit - written));
+            }
+            if (std::fwrite(buffer.data(), 1, toWrite, stdout) != toWrite) {
+                return 0; // Consumer closed the pipe
+            }
+            written += toWrite;
+        }
+        std::fflush(stdout);
+        return 0;
+    }
+
+    void printUsage()
+    {
+        std::fprintf(stderr,
+                     "usage: random_quality [--samples n] [--seed n] [--only name] [--list]\n"
+                     "                      [--stream name [--stream-bytes n]]\n");
+    }
+} // namespace
+
+int main(int argc, char** argv)
+{
+    std::size_t samples = std::size_t{1} << 22;
+    unsigned int seed = 20240601u;
+    std::string only;
+    std::string streamName;
+    std::uint64_t streamBytes = 0;
+    bool listOnly = false;
+
+    for (int i = 1; i < argc; ++i) {
+        const std::string argument = argv[i];
+        const bool hasValue = i + 1 < argc;
+
+        if (argument == "--samples" && hasValue) {
+            samples = static_cast<std::size_t>(std::strtoull(argv[++i], nullptr, 10));
+        } else if (argument == "--seed" && hasValue) {
+            seed = static_cast<unsigned int>(std::strtoul(argv[++i], nullptr, 10));
+        } else if (argument == "--only" && hasValue) {
+            only = argv[++i];
+        } else if (argument == "--stream" && hasValue) {
+            streamName = argv[++i];
+        } else if (argument == "--stream-bytes" && hasValue) {
+            streamBytes = std::strtoull(argv[++i], nullptr, 10);
+        } else if (argument == "--list") {
+            listOnly = true;
+        } else {
+            printUsage();
+            return 2;
+        }
+    }
+
+    if (samples < 1000) {
+        std::fprintf(stderr, "random_quality: --samples must be at least 1000\n");
+        return 2;
+    }
+
+    setSeed(seed);
+    const std::vector<UniformSource> uniform = uniformSources(samples);
+    const std::vector<DiscreteSource> discrete = discreteSources();
+
+    if (listOnly) {
+        for (const UniformSource& source : uniform) {
+            std::printf("%s\n", source.name.c_str());
+        }
+        for (const DiscreteSource& source : discrete) {
+            std::printf("%s\n", source.name.c_str());
+        }
+        return 0;
+    }
+
+    if (!streamName.empty()) {
+        for (const UniformSource& source : uniform) {
+            if (source.name == streamName) {
+                return streamSource(source, streamBytes);
+            }
+        }
+        std::fprintf(stderr, "random_quality: unknown uniform source '%s' (see --list)\n", streamName.c_str());
+        return 2;
+    }
+
+    std::printf("stevensMathLib random quality report (seed %u, %zu samples per uniform source)\n", seed, samples);
+    std::printf("p-values; FAIL below %.0e in either tail, suspect below %.0e\n\n", failThreshold, suspectThreshold);
+    std::printf("%-28s %10s %10s %10s %10s %10s %10s   %s\n", "source", "chi2", "gap", "runs", "birthday", "serial",
+                "M/s", "verdict");
+
+    bool allPassed = true;
+    bool ranAny = false;
+    for (const UniformSource& source : uniform) {
+        if (!only.empty() && source.name != only) {
+            continue;
+        }
+        ranAny = true;
+        allPassed = runUniform(source, samples) && allPassed;
+    }
+    for (const DiscreteSource& source : discrete) {
+        if (!only.empty() && source.name != only) {
+            continue;
+        }
+        ranAny = true;
+        allPassed = runDiscrete(source, samples / 4) && allPassed;
+    }
+
+    if (!ranAny) {
+        std::fprintf(stderr, "random_quality: unknown source '%s' (see --list)\n", only.c_str());
+        return 2;
+    }
+
+    std::printf("\nThroughput includes one std::function call per value.\n");
+    return allPassed ? 0 : 1;
+}
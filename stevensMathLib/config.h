@@ -0,0 +1,17 @@
+/**
+ * stevensMathLib/config.h
+ *
+ * Build configuration shared by the stevensMathLib headers.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+// Runtime CPU feature dispatch for the SIMD kernels (GCC/Clang on x86)
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__))
+#define STEVENSMATHLIB_X86_DISPATCH 1
+#endif
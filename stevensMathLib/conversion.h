@@ -0,0 +1,101 @@
+/**
+ * stevensMathLib/conversion.h
+ *
+ * Checked floating point to integer conversions.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "instrumentation.h"
+
+#include <cmath>
+#include <cstdio>
+#include <limits>
+#include <type_traits>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Safely converts a floating point number to an integer
+     *
+     * @tparam FloatType The floating point type (float, double, long double)
+     * @param value The floating point value to convert
+     * @return The value converted to int, or int::max() if out of range
+     *
+     * This function checks if the float value fits within the int range
+     * before conversion. If out of range, it prints a warning and returns
+     * the maximum int value.
+     */
+    template <typename FloatType>
+    int floatToInt(const FloatType& value)
+    {
+        detail::countEvent(InstrumentationCounter::FloatToIntCalls);
+
+        const bool floatHasMorePrecision =
+            std::numeric_limits<int>::digits < std::numeric_limits<FloatType>::digits;
+
+        if (!floatHasMorePrecision) {
+            return static_cast<int>(value);
+        }
+
+        const FloatType maxIntAsFloat = static_cast<FloatType>(std::numeric_limits<int>::max());
+        const FloatType minIntAsFloat = static_cast<FloatType>(std::numeric_limits<int>::min());
+
+        const bool fitsInInt = (value < maxIntAsFloat) && (value > minIntAsFloat);
+
+        if (fitsInInt) {
+            return static_cast<int>(value);
+        }
+
+        detail::countEvent(InstrumentationCounter::FloatToIntOutOfRange);
+        std::fprintf(stderr, "Warning: unsafe conversion of value %Lg to int. Returning int::max().\n",
+                     static_cast<long double>(value));
+        return std::numeric_limits<int>::max();
+    }
+
+    /**
+     * @brief Safely converts a floating point number to any integer type
+     *
+     * @tparam IntType The target integer type, e.g. std::int64_t or std::uint64_t
+     * @tparam FloatType The floating point type (float, double, long double)
+     * @param value The floating point value to convert (truncated toward zero)
+     * @return The converted value; out-of-range values saturate
+     *
+     * The 64-bit counterpart of floatToInt(). A plain static_cast is undefined
+     * for values past the target's range, and the limits themselves are easy
+     * to get wrong: double(INT64_MAX) rounds up to 2^63, which does not fit.
+     * Here the bounds are the exact powers of two, so every value whose
+     * truncation fits is converted and nothing else is. Out-of-range values
+     * print a warning and return max() (or min() for values below the range;
+     * NaN returns max()).
+     */
+    template <typename IntType, typename FloatType>
+    IntType floatToInteger(const FloatType& value)
+    {
+        static_assert(std::is_integral<IntType>::value && !std::is_same<IntType, bool>::value,
+                      "stevensMathLib::floatToInteger requires a non-bool integer target");
+        static_assert(std::is_floating_point<FloatType>::value,
+                      "stevensMathLib::floatToInteger requires a floating point source");
+        detail::countEvent(InstrumentationCounter::FloatToIntCalls);
+
+        // 2^digits is one past max(); min() is 0 or -2^digits
+        const FloatType upperLimit = std::ldexp(FloatType(1), std::numeric_limits<IntType>::digits);
+        const FloatType lowerLimit = std::is_signed<IntType>::value ? -upperLimit : FloatType(0);
+
+        if (value < upperLimit && std::trunc(value) >= lowerLimit) {
+            return static_cast<IntType>(value);
+        }
+
+        detail::countEvent(InstrumentationCounter::FloatToIntOutOfRange);
+        const bool below = std::trunc(value) < lowerLimit;
+        std::fprintf(stderr, "Warning: unsafe conversion of value %Lg to a %d-bit integer. Returning %s.\n",
+                     static_cast<long double>(value), std::numeric_limits<IntType>::digits + std::is_signed<IntType>::value,
+                     below ? "min()" : "max()");
+        return below ? std::numeric_limits<IntType>::min() : std::numeric_limits<IntType>::max();
+    }
+} // namespace stevensMathLib
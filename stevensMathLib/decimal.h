@@ -0,0 +1,455 @@
+/**
+ * stevensMathLib/decimal.h
+ *
+ * RoundingMode and the fixed-point Decimal type.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "rounding.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Rounding rules for Decimal construction and arithmetic
+     */
+    enum class RoundingMode
+    {
+        HalfAwayFromZero,  // Same tie-breaking as std::round() and round()
+        HalfEven,          // Banker's rounding: ties go to the even neighbour
+        TowardZero,        // Truncate
+        Floor,             // Toward negative infinity
+        Ceiling            // Toward positive infinity
+    };
+
+    namespace detail
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef __int128 WideInt;
+#else
+        // Without a 128-bit type, Decimal products must themselves fit in 64 bits
+        typedef long long WideInt;
+#endif
+
+        /**
+         * @brief Checks whether a * b falls outside the int64_t range
+         *
+         * Uses only divisions by the operands, so it never overflows itself.
+         */
+        constexpr bool productOverflowsInt64(std::int64_t a, std::int64_t b)
+        {
+            constexpr std::int64_t maxValue = std::numeric_limits<std::int64_t>::max();
+            constexpr std::int64_t minValue = std::numeric_limits<std::int64_t>::min();
+            if (a == 0 || b == 0) {
+                return false;
+            }
+            if (a > 0) {
+                return b > 0 ? a > maxValue / b : b < minValue / a;
+            }
+            return b > 0 ? a < minValue / b : b < maxValue / a;
+        }
+
+        /**
+         * @brief Widening multiply of two int64_t values
+         *
+         * @throws std::overflow_error if WideInt is only 64 bits and the product does not fit
+         */
+        inline WideInt multiplyWide(std::int64_t a, std::int64_t b)
+        {
+#if !defined(__SIZEOF_INT128__)
+            if (productOverflowsInt64(a, b)) {
+                throw std::overflow_error("stevensMathLib::Decimal - result out of range");
+            }
+#endif
+            return static_cast<WideInt>(a) * b;
+        }
+
+        constexpr std::int64_t powerOf10(int exponent)
+        {
+            std::int64_t result = 1;
+            for (int i = 0; i < exponent; ++i) {
+                result *= 10;
+            }
+            return result;
+        }
+
+        /**
+         * @brief Integer division that rounds the quotient according to mode
+         */
+        template <typename IntType>
+        IntType divideRounded(IntType numerator, IntType denominator, RoundingMode mode)
+        {
+            const IntType quotient = numerator / denominator;
+            const IntType remainder = numerator % denominator;
+            if (remainder == 0) {
+                return quotient;
+            }
+
+            const bool negativeResult = (numerator < 0) != (denominator < 0);
+            const IntType awayFromZero = negativeResult ? quotient - 1 : quotient + 1;
+            // Compare |remainder| with its distance to |denominator| rather than doubling it,
+            // so neither step can overflow when the denominator is near the type's limits
+            const IntType absRemainder = remainder < 0 ? -remainder : remainder;
+            const IntType distanceToNext = denominator < 0
+                ? -(denominator + absRemainder)
+                : denominator - absRemainder;
+
+            switch (mode) {
+                case RoundingMode::TowardZero:
+                    return quotient;
+                case RoundingMode::Floor:
+                    return negativeResult ? awayFromZero : quotient;
+                case RoundingMode::Ceiling:
+                    return negativeResult ? quotient : awayFromZero;
+                case RoundingMode::HalfEven:
+                    if (absRemainder == distanceToNext) {
+                        return (quotient % 2 == 0) ? quotient : awayFromZero;
+                    }
+                    return absRemainder > distanceToNext ? awayFromZero : quotient;
+                case RoundingMode::HalfAwayFromZero:
+                default:
+                    return absRemainder >= distanceToNext ? awayFromZero : quotient;
+            }
+        }
+
+        /**
+         * @brief Writes magnitude / 10^decimalPlaces as fixed-point text
+         *
+         * @param buffer Destination (not null-terminated)
+         * @param bufferSize Capacity of buffer in chars
+         * @param magnitude Absolute value of the scaled integer
+         * @param negative Whether to emit a leading '-'
+         * @param decimalPlaces Digits after the decimal point (0 omits the point)
+         * @return Number of chars written, or 0 if the buffer is too small
+         */
+        inline std::size_t writeFixedPoint(char* buffer, std::size_t bufferSize,
+                                           std::uint64_t magnitude, bool negative,
+                                           int decimalPlaces)
+        {
+            static constexpr char digitPairs[] =
+                "00010203040506070809101112131415161718192021222324252627282930313233343536373839"
+                "40414243444546474849505152535455565758596061626364656667686970717273747576777879"
+                "8081828384858687888990919293949596979899";
+
+            // Digits are produced least significant first, two at a time
+            char digits[24];
+            std::size_t digitCount = 0;
+            while (magnitude >= 100) {
+                const std::size_t pair = static_cast<std::size_t>(magnitude % 100) * 2;
+                magnitude /= 100;
+                digits[digitCount++] = digitPairs[pair + 1];
+                digits[digitCount++] = digitPairs[pair];
+            }
+            if (magnitude >= 10) {
+                const std::size_t pair = static_cast<std::size_t>(magnitude) * 2;
+                digits[digitCount++] = digitPairs[pair + 1];
+                digits[digitCount++] = digitPairs[pair];
+            } else {
+                digits[digitCount++] = static_cast<char>('0' + magnitude);
+            }
+
+            const std::size_t fractionDigits = static_cast<std::size_t>(decimalPlaces);
+            while (digitCount <= fractionDigits) {
+                digits[digitCount++] = '0';
+            }
+
+            const std::size_t length = digitCount + (negative ? 1 : 0) + (fractionDigits > 0 ? 1 : 0);
+            if (length > bufferSize) {
+                return 0;
+            }
+
+            std::size_t position = 0;
+            if (negative) {
+                buffer[position++] = '-';
+            }
+            for (std::size_t i = digitCount; i > 0; --i) {
+                if (i == fractionDigits) {
+                    buffer[position++] = '.';
+                }
+                buffer[position++] = digits[i - 1];
+            }
+            return position;
+        }
+
+        /**
+         * @brief Rounds a floating point value to an integral value according to mode
+         */
+        inline double roundWithMode(double value, RoundingMode mode)
+        {
+            switch (mode) {
+                case RoundingMode::TowardZero:
+                    return std::trunc(value);
+                case RoundingMode::Floor:
+                    return std::floor(value);
+                case RoundingMode::Ceiling:
+                    return std::ceil(value);
+                case RoundingMode::HalfEven: {
+                    const double rounded = std::round(value);
+                    const bool isTie = std::abs(value - std::trunc(value)) == 0.5;
+                    return isTie ? 2.0 * std::round(value / 2.0) : rounded;
+                }
+                case RoundingMode::HalfAwayFromZero:
+                default:
+                    return std::round(value);
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Fixed-point decimal stored as a scaled 64-bit integer
+     *
+     * @tparam DecimalPlaces Number of digits kept after the decimal point (0-18)
+     *
+     * A Decimal<2> holding 3.14 stores the integer 314. Rounding to N places
+     * happens once, when the value is built from a float; after that addition
+     * and subtraction are plain integer operations and never accumulate
+     * floating point error. Multiplication and division use a 128-bit
+     * intermediate (where the compiler provides one) and round the result
+     * with a selectable RoundingMode.
+     *
+     * Example:
+     *   Decimal<2> price = Decimal<2>::fromFloat(19.999);  // 20.00
+     *   Decimal<2> total = price * Decimal<2>(3);          // 60.00
+     */
+    template <int DecimalPlaces>
+    class Decimal
+    {
+        static_assert(DecimalPlaces >= 0 && DecimalPlaces <= 18,
+                      "Decimal supports between 0 and 18 decimal places");
+
+    public:
+        static constexpr int decimalPlaces = DecimalPlaces;
+        static constexpr std::int64_t scale = detail::powerOf10(DecimalPlaces);
+
+        constexpr Decimal() = default;
+
+        /**
+         * @brief Creates a Decimal holding a whole number
+         *
+         * @throws std::out_of_range if the value does not fit after scaling
+         */
+        explicit Decimal(std::int64_t wholeNumber)
+        {
+            if (wholeNumber > std::numeric_limits<std::int64_t>::max() / scale ||
+                wholeNumber < std::numeric_limits<std::int64_t>::min() / scale) {
+                throw std::out_of_range("stevensMathLib::Decimal - whole number out of range");
+            }
+            scaled_ = wholeNumber * scale;
+        }
+
+        /**
+         * @brief Creates a Decimal directly from its scaled integer representation
+         *
+         * Example: Decimal<2>::fromScaled(314) holds 3.14
+         */
+        static constexpr Decimal fromScaled(std::int64_t scaledValue)
+        {
+            Decimal result;
+            result.scaled_ = scaledValue;
+            return result;
+        }
+
+        /**
+         * @brief Rounds a floating point value to DecimalPlaces digits
+         *
+         * @param value The value to convert
+         * @param mode How to round digits beyond DecimalPlaces
+         * @return The rounded Decimal
+         *
+         * @throws std::out_of_range if value is NaN, infinite or too large
+         *
+         * Costs one multiply and one rounding instruction.
+         */
+        static Decimal fromFloat(double value, RoundingMode mode = RoundingMode::HalfAwayFromZero)
+        {
+            const double scaledValue = detail::roundWithMode(value * static_cast<double>(scale), mode);
+
+            // 2^63 is exactly representable, so this also rejects NaN and infinity
+            const double limit = 9223372036854775808.0;
+            if (!(scaledValue >= -limit && scaledValue < limit)) {
+                throw std::out_of_range("stevensMathLib::Decimal - value out of range");
+            }
+            return fromScaled(static_cast<std::int64_t>(scaledValue));
+        }
+
+        constexpr std::int64_t scaled() const { return scaled_; }
+
+        double toDouble() const
+        {
+            return static_cast<double>(scaled_) / static_cast<double>(scale);
+        }
+
+        float toFloat() const
+        {
+            return static_cast<float>(toDouble());
+        }
+
+        /**
+         * @brief Converts to a different number of decimal places
+         *
+         * @throws std::out_of_range if widening overflows
+         */
+        template <int OtherPlaces>
+        Decimal<OtherPlaces> rescale(RoundingMode mode = RoundingMode::HalfAwayFromZero) const
+        {
+            if constexpr (OtherPlaces >= DecimalPlaces) {
+                const std::int64_t factor = detail::powerOf10(OtherPlaces - DecimalPlaces);
+                return Decimal<OtherPlaces>::fromScaled(checkedNarrow(
+                    detail::multiplyWide(scaled_, factor)));
+            } else {
+                const std::int64_t divisor = detail::powerOf10(DecimalPlaces - OtherPlaces);
+                return Decimal<OtherPlaces>::fromScaled(
+                    detail::divideRounded<std::int64_t>(scaled_, divisor, mode));
+            }
+        }
+
+        /**
+         * @brief Multiplies two Decimals, rounding the result to DecimalPlaces
+         *
+         * @throws std::overflow_error if the product does not fit
+         */
+        static Decimal multiply(Decimal lhs, Decimal rhs,
+                                RoundingMode mode = RoundingMode::HalfAwayFromZero)
+        {
+            const detail::WideInt product = detail::multiplyWide(lhs.scaled_, rhs.scaled_);
+            if (fitsInInt64(product)) {
+                // Common case: avoid the much slower 128-bit division routine
+                return fromScaled(detail::divideRounded<std::int64_t>(
+                    static_cast<std::int64_t>(product), scale, mode));
+            }
+            return fromScaled(checkedNarrow(
+                detail::divideRounded<detail::WideInt>(product, scale, mode)));
+        }
+
+        /**
+         * @brief Divides two Decimals, rounding the result to DecimalPlaces
+         *
+         * @throws std::domain_error if rhs is zero
+         * @throws std::overflow_error if the quotient does not fit
+         */
+        static Decimal divide(Decimal lhs, Decimal rhs,
+                              RoundingMode mode = RoundingMode::HalfAwayFromZero)
+        {
+            if (rhs.scaled_ == 0) {
+                throw std::domain_error("stevensMathLib::Decimal - division by zero");
+            }
+
+            const detail::WideInt numerator = detail::multiplyWide(lhs.scaled_, scale);
+            if (rhs.scaled_ == -1 && numerator == std::numeric_limits<std::int64_t>::min()) {
+                // The one int64_t quotient that does not fit; dividing would be undefined
+                throw std::overflow_error("stevensMathLib::Decimal - result out of range");
+            }
+            if (fitsInInt64(numerator)) {
+                return fromScaled(detail::divideRounded<std::int64_t>(
+                    static_cast<std::int64_t>(numerator), rhs.scaled_, mode));
+            }
+            return fromScaled(checkedNarrow(
+                detail::divideRounded<detail::WideInt>(numerator, rhs.scaled_, mode)));
+        }
+
+        /**
+         * @brief Writes the value as text, e.g. "-3.14" for Decimal<2>
+         *
+         * @param buffer Destination (not null-terminated)
+         * @param bufferSize Capacity of buffer in chars
+         * @return Number of chars written, or 0 if the buffer is too small
+         */
+        std::size_t toChars(char* buffer, std::size_t bufferSize) const
+        {
+            // Work in unsigned space so INT64_MIN can be negated safely
+            const std::uint64_t magnitude = scaled_ < 0
+                ? std::uint64_t{0} - static_cast<std::uint64_t>(scaled_)
+                : static_cast<std::uint64_t>(scaled_);
+            return detail::writeFixedPoint(buffer, bufferSize, magnitude, scaled_ < 0, DecimalPlaces);
+        }
+
+        std::string toString() const
+        {
+            char buffer[24];
+            return std::string(buffer, toChars(buffer, sizeof(buffer)));
+        }
+
+        /**
+         * @throws std::overflow_error if the sum does not fit
+         */
+        Decimal& operator+=(Decimal rhs)
+        {
+            if (rhs.scaled_ > 0 ? scaled_ > std::numeric_limits<std::int64_t>::max() - rhs.scaled_
+                                : scaled_ < std::numeric_limits<std::int64_t>::min() - rhs.scaled_) {
+                throw std::overflow_error("stevensMathLib::Decimal - result out of range");
+            }
+            scaled_ += rhs.scaled_;
+            return *this;
+        }
+
+        /**
+         * @throws std::overflow_error if the difference does not fit
+         */
+        Decimal& operator-=(Decimal rhs)
+        {
+            if (rhs.scaled_ < 0 ? scaled_ > std::numeric_limits<std::int64_t>::max() + rhs.scaled_
+                                : scaled_ < std::numeric_limits<std::int64_t>::min() + rhs.scaled_) {
+                throw std::overflow_error("stevensMathLib::Decimal - result out of range");
+            }
+            scaled_ -= rhs.scaled_;
+            return *this;
+        }
+
+        Decimal& operator*=(Decimal rhs) { return *this = multiply(*this, rhs); }
+        Decimal& operator/=(Decimal rhs) { return *this = divide(*this, rhs); }
+
+        friend Decimal operator+(Decimal lhs, Decimal rhs) { return lhs += rhs; }
+        friend Decimal operator-(Decimal lhs, Decimal rhs) { return lhs -= rhs; }
+        friend Decimal operator*(Decimal lhs, Decimal rhs) { return multiply(lhs, rhs); }
+        friend Decimal operator/(Decimal lhs, Decimal rhs) { return divide(lhs, rhs); }
+        friend Decimal operator-(Decimal value) { return Decimal() -= value; }
+
+        friend bool operator==(Decimal lhs, Decimal rhs) { return lhs.scaled_ == rhs.scaled_; }
+        friend bool operator!=(Decimal lhs, Decimal rhs) { return lhs.scaled_ != rhs.scaled_; }
+        friend bool operator<(Decimal lhs, Decimal rhs) { return lhs.scaled_ < rhs.scaled_; }
+        friend bool operator<=(Decimal lhs, Decimal rhs) { return lhs.scaled_ <= rhs.scaled_; }
+        friend bool operator>(Decimal lhs, Decimal rhs) { return lhs.scaled_ > rhs.scaled_; }
+        friend bool operator>=(Decimal lhs, Decimal rhs) { return lhs.scaled_ >= rhs.scaled_; }
+
+    private:
+        static bool fitsInInt64(detail::WideInt value)
+        {
+            return value <= std::numeric_limits<std::int64_t>::max() &&
+                   value >= std::numeric_limits<std::int64_t>::min();
+        }
+
+        static std::int64_t checkedNarrow(detail::WideInt value)
+        {
+            if (!fitsInInt64(value)) {
+                throw std::overflow_error("stevensMathLib::Decimal - result out of range");
+            }
+            return static_cast<std::int64_t>(value);
+        }
+
+        std::int64_t scaled_ = 0;
+    };
+
+    /**
+     * @brief Checks if a Decimal has no fractional part
+     *
+     * Exact, unlike the float overload: a single integer remainder.
+     */
+    template <int DecimalPlaces>
+    bool isWholeNumber(Decimal<DecimalPlaces> value)
+    {
+        return value.scaled() % Decimal<DecimalPlaces>::scale == 0;
+    }
+} // namespace stevensMathLib
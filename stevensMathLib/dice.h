@@ -0,0 +1,626 @@
+/**
+ * stevensMathLib/dice.h
+ *
+ * DiceRoll: compiled dice expressions such as "3d6+2".
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+#include "sampling.h"
+
+#include <algorithm>
+#include <cctype>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <limits>
+#include <optional>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief A dice expression such as "3d6+2" compiled once for fast repeated rolls
+     *
+     * Supported syntax (case-insensitive, spaces ignored between terms):
+     *   NdS          N dice with S sides (N defaults to 1: "d20")
+     *   NdSkhM, NdSkM  keep the highest M dice     e.g. "2d20kh1" (advantage)
+     *   NdSklM       keep the lowest M dice        e.g. "2d20kl1" (disadvantage)
+     *   NdSdlM, NdSdM  drop the lowest M dice
+     *   NdSdhM       drop the highest M dice
+     *   NdS drop lowest [M], NdS drop highest [M], NdS keep highest [M], NdS keep lowest [M]
+     *   integer constants, combined with + and -   e.g. "1d8 + 1d6 - 2"
+     *
+     * When the total has at most maxExactOutcomes possible values and the
+     * terms are small enough to tabulate, the exact outcome distribution is
+     * computed at construction and each roll is a single O(1) alias-table
+     * sample. Otherwise rolls fall back to drawing every die with bounded
+     * integer draws. expectedValue() is always exact.
+     *
+     * Example:
+     *   const DiceRoll stats("4d6 drop lowest");
+     *   int strength = stats.roll();
+     *   double average = stats.expectedValue();  // 12.24...
+     */
+    class DiceRoll
+    {
+    public:
+        static constexpr std::size_t maxExactOutcomes = 1 << 16;
+        static constexpr int maxDiceCount = 1000000;
+        static constexpr int maxSides = 1000000;
+
+        /**
+         * @brief Parses and compiles a dice expression
+         *
+         * @throws std::invalid_argument if the expression is malformed or its
+         *         totals would not fit in an int
+         */
+        explicit DiceRoll(const std::string& expression)
+            : expression_(expression)
+        {
+            parse();
+            computeRange();
+            computeExpectedValue();
+            buildExactDistribution();
+        }
+
+        /**
+         * @brief Rolls the expression using getRandomEngine()
+         */
+        int roll() const
+        {
+            return roll(getRandomEngine());
+        }
+
+        /**
+         * @brief Rolls the expression using the given engine
+         */
+        template <typename Engine>
+        int roll(Engine& engine) const
+        {
+            if (hasExactDistribution()) {
+                return minimum_ + static_cast<int>(outcomeSampler_.sample(engine));
+            }
+
+            std::int64_t total = constant_;
+            for (const DiceTerm& term : terms_) {
+                total += term.sign * rollTerm(term, engine);
+            }
+            return static_cast<int>(total);
+        }
+
+        /**
+         * @brief Rolls the expression count times into results
+         */
+        void rollBatch(int* results, std::size_t count) const
+        {
+            std::mt19937& engine = getRandomEngine();
+            for (std::size_t i = 0; i < count; ++i) {
+                results[i] = roll(engine);
+            }
+        }
+
+        /**
+         * @brief Whether rolls use a precomputed exact distribution
+         */
+        bool hasExactDistribution() const { return !probabilities_.empty(); }
+
+        int minimum() const { return minimum_; }
+        int maximum() const { return maximum_; }
+        double expectedValue() const { return expectedValue_; }
+        const std::string& expression() const { return expression_; }
+
+        /**
+         * @brief Exact probability of every total from minimum() to maximum()
+         *
+         * Entry i is the probability of rolling minimum() + i. Empty if the
+         * expression is too large for an exact table (see hasExactDistribution()).
+         */
+        const std::vector<double>& probabilities() const { return probabilities_; }
+
+        /**
+         * @brief Exact probability of rolling exactly total
+         *
+         * @throws std::logic_error if no exact distribution is available
+         */
+        double probabilityOf(int total) const
+        {
+            if (!hasExactDistribution()) {
+                throw std::logic_error(
+                    "stevensMathLib::DiceRoll - expression too large for an exact distribution");
+            }
+            if (total < minimum_ || total > maximum_) {
+                return 0.0;
+            }
+            return probabilities_[static_cast<std::size_t>(total - minimum_)];
+        }
+
+    private:
+        struct DiceTerm
+        {
+            int sign;
+            int count;
+            int sides;
+            int keep;          // Number of dice that count toward the total
+            bool keepHighest;  // Which end the kept dice come from
+        };
+
+        // Upper bound on floating point operations spent building one keep/drop table
+        static constexpr double maxKeepTableWork = 5e7;
+
+        // Upper bound on window steps spent building one plain-sum table
+        static constexpr double maxSumTableWork = 5e7;
+
+        // Parsing
+
+        void parse()
+        {
+            std::string text;
+            for (const char character : expression_) {
+                text.push_back(static_cast<char>(std::tolower(static_cast<unsigned char>(character))));
+            }
+
+            std::size_t position = 0;
+            int sign = 1;
+            skipSpaces(text, position);
+            if (isAt(text, position, '-') || isAt(text, position, '+')) {
+                sign = text[position++] == '-' ? -1 : 1;
+            }
+
+            while (true) {
+                parseTerm(text, position, sign);
+                skipSpaces(text, position);
+                if (position == text.size()) {
+                    break;
+                }
+                if (text[position] != '+' && text[position] != '-') {
+                    fail("expected '+' or '-'");
+                }
+                sign = text[position] == '+' ? 1 : -1;
+                ++position;
+            }
+        }
+
+        void parseTerm(const std::string& text, std::size_t& position, int sign)
+        {
+            skipSpaces(text, position);
+            const std::optional<std::int64_t> leading = parseNumber(text, position);
+
+            if (position >= text.size() || text[position] != 'd' || !isDigitAt(text, position + 1)) {
+                if (!leading) {
+                    fail("expected a number or dice term");
+                }
+                constant_ += sign * *leading;
+                checkMagnitude(constant_);
+                return;
+            }
+
+            ++position;  // 'd'
+            DiceTerm term{sign, static_cast<int>(leading.value_or(1)), 0, 0, true};
+            if (leading && (*leading < 1 || *leading > maxDiceCount)) {
+                fail("dice count out of range");
+            }
+            const std::int64_t sides = *parseNumber(text, position);
+            if (sides < 1 || sides > maxSides) {
+                fail("number of sides out of range");
+            }
+            term.sides = static_cast<int>(sides);
+            term.keep = term.count;
+
+            parseKeepModifier(text, position, term);
+            terms_.push_back(term);
+        }
+
+        void parseKeepModifier(const std::string& text, std::size_t& position, DiceTerm& term)
+        {
+            const std::size_t start = position;
+            skipSpaces(text, position);
+
+            bool isKeep = false;
+            bool highest = true;
+            bool numberRequired = true;
+            if (consume(text, position, "kh") || (isAt(text, position, 'k') && isDigitAt(text, position + 1) && consume(text, position, "k"))) {
+                isKeep = true;
+            } else if (consume(text, position, "kl")) {
+                isKeep = true;
+                highest = false;
+            } else if (consume(text, position, "dh")) {
+            } else if (consume(text, position, "dl") || (isAt(text, position, 'd') && isDigitAt(text, position + 1) && consume(text, position, "d"))) {
+                highest = false;
+            } else if (consume(text, position, "drop") || consume(text, position, "keep")) {
+                isKeep = text.compare(position - 4, 4, "keep") == 0;
+                skipSpaces(text, position);
+                if (consume(text, position, "lowest")) {
+                    highest = false;
+                } else if (!consume(text, position, "highest")) {
+                    fail("expected 'highest' or 'lowest'");
+                }
+                numberRequired = false;
+            } else {
+                position = start;
+                return;
+            }
+
+            skipSpaces(text, position);
+            const std::optional<std::int64_t> amount = parseNumber(text, position);
+            if (!amount && numberRequired) {
+                fail("expected a number of dice to keep or drop");
+            }
+
+            const std::int64_t diceAffected = amount.value_or(1);
+            const std::int64_t kept = isKeep ? diceAffected : term.count - diceAffected;
+            if (kept < 1 || kept > term.count) {
+                fail("keep/drop count out of range");
+            }
+
+            term.keep = static_cast<int>(kept);
+            // Dropping the lowest dice keeps the highest ones and vice versa
+            term.keepHighest = isKeep ? highest : !highest;
+        }
+
+        static void skipSpaces(const std::string& text, std::size_t& position)
+        {
+            while (position < text.size() && std::isspace(static_cast<unsigned char>(text[position]))) {
+                ++position;
+            }
+        }
+
+        static bool isAt(const std::string& text, std::size_t position, char expected)
+        {
+            return position < text.size() && text[position] == expected;
+        }
+
+        static bool isDigitAt(const std::string& text, std::size_t position)
+        {
+            return position < text.size() && std::isdigit(static_cast<unsigned char>(text[position]));
+        }
+
+        static bool consume(const std::string& text, std::size_t& position, const char* word)
+        {
+            const std::size_t length = std::strlen(word);
+            if (text.compare(position, length, word) != 0) {
+                return false;
+            }
+            position += length;
+            return true;
+        }
+
+        std::optional<std::int64_t> parseNumber(const std::string& text, std::size_t& position) const
+        {
+            if (!isDigitAt(text, position)) {
+                return std::nullopt;
+            }
+
+            std::int64_t value = 0;
+            while (isDigitAt(text, position)) {
+                value = value * 10 + (text[position++] - '0');
+                checkMagnitude(value);
+            }
+            return value;
+        }
+
+        void checkMagnitude(std::int64_t value) const
+        {
+            if (value > std::numeric_limits<int>::max() || value < -std::numeric_limits<int>::max()) {
+                fail("value does not fit in an int");
+            }
+        }
+
+        [[noreturn]] void fail(const char* reason) const
+        {
+            throw std::invalid_argument("stevensMathLib::DiceRoll - " + std::string(reason) +
+                                        " in \"" + expression_ + "\"");
+        }
+
+        // Analysis
+
+        void computeRange()
+        {
+            std::int64_t minimum = constant_;
+            std::int64_t maximum = constant_;
+            for (const DiceTerm& term : terms_) {
+                const std::int64_t low = term.keep;
+                const std::int64_t high = static_cast<std::int64_t>(term.keep) * term.sides;
+                minimum += term.sign > 0 ? low : -high;
+                maximum += term.sign > 0 ? high : -low;
+                checkMagnitude(minimum);
+                checkMagnitude(maximum);
+            }
+            minimum_ = static_cast<int>(minimum);
+            maximum_ = static_cast<int>(maximum);
+        }
+
+        void computeExpectedValue()
+        {
+            expectedValue_ = static_cast<double>(constant_);
+            for (const DiceTerm& term : terms_) {
+                expectedValue_ += term.sign * termExpectedValue(term);
+            }
+        }
+
+        /**
+         * Sum of the kept dice = sum over faces v of (kept dice showing >= v).
+         * For keep-highest that count is min(keep, #dice >= v); for keep-lowest
+         * it is max(0, keep - #dice < v). Both counts are binomial, so the
+         * expectation is exact; each face only sums the binomial terms that
+         * are not negligible, so the cost does not grow with keep.
+         */
+        static double termExpectedValue(const DiceTerm& term)
+        {
+            if (term.keep == term.count) {
+                return term.count * (term.sides + 1) / 2.0;
+            }
+
+            double expected = 0.0;
+            for (int face = 1; face <= term.sides; ++face) {
+                const double shortfallProbability = term.keepHighest
+                    ? static_cast<double>(term.sides - face + 1) / term.sides
+                    : static_cast<double>(face - 1) / term.sides;
+                const double shortfall = expectedShortfall(term.count, shortfallProbability, term.keep);
+                expected += term.keepHighest ? term.keep - shortfall : shortfall;
+            }
+            return expected;
+        }
+
+        /**
+         * E[max(0, limit - B)] for B ~ Binomial(trials, probability)
+         *
+         * Only the tail on the far side of limit from the mean is summed (using
+         * E[max(0, limit - B)] = limit - mean + E[max(0, B - limit)] when limit
+         * is above the mean). The tail is walked away from limit with the pmf
+         * ratio recurrence and stops once the terms fall below double precision,
+         * so each call costs O(1) lgamma calls plus O(sqrt(trials)) products.
+         */
+        static double expectedShortfall(int trials, double probability, int limit)
+        {
+            if (probability >= 1.0) {
+                return limit > trials ? limit - trials : 0.0;
+            }
+            if (probability <= 0.0) {
+                return limit;
+            }
+
+            static constexpr double negligibleProbability = 1e-20;
+            const double mean = trials * probability;
+            const bool sumUpperTail = limit > mean;
+            const int first = sumUpperTail ? limit + 1 : limit - 1;
+            if (first < 0 || first > trials) {
+                return sumUpperTail ? limit - mean : 0.0;
+            }
+
+            // P(B = s + 1) / P(B = s) = odds * (trials - s) / (s + 1)
+            const double odds = probability / (1.0 - probability);
+            double pmf = std::exp(std::lgamma(trials + 1.0) - std::lgamma(first + 1.0) -
+                                  std::lgamma(trials - first + 1.0) + first * std::log(probability) +
+                                  (trials - first) * std::log1p(-probability));
+
+            double tail = 0.0;
+            double previous = std::numeric_limits<double>::infinity();
+            int successes = first;
+            while (successes >= 0 && successes <= trials) {
+                // The pmf may rise for one step near the mode before it falls for good
+                if (pmf < negligibleProbability && pmf <= previous) {
+                    break;
+                }
+                tail += std::abs(limit - successes) * pmf;
+                previous = pmf;
+                if (sumUpperTail) {
+                    pmf *= odds * (trials - successes) / (successes + 1.0);
+                    ++successes;
+                } else {
+                    pmf *= successes / (odds * (trials - successes + 1.0));
+                    --successes;
+                }
+            }
+            return sumUpperTail ? limit - mean + tail : tail;
+        }
+
+        void buildExactDistribution()
+        {
+            if (static_cast<std::int64_t>(maximum_) - minimum_ + 1 > static_cast<std::int64_t>(maxExactOutcomes)) {
+                return;
+            }
+
+            std::vector<double> distribution{1.0};  // Total of zero dice
+            for (const DiceTerm& term : terms_) {
+                std::vector<double> termDistribution = term.keep == term.count
+                    ? sumDistribution(term.count, term.sides)
+                    : keepDistribution(term);
+                if (termDistribution.empty()) {
+                    return;
+                }
+                if (term.sign < 0) {
+                    std::reverse(termDistribution.begin(), termDistribution.end());
+                }
+                distribution = convolve(distribution, termDistribution);
+            }
+
+            probabilities_ = std::move(distribution);
+            outcomeSampler_ = AliasTable(probabilities_);
+        }
+
+        /**
+         * Distribution of the sum of count dice, offset so index 0 is the
+         * minimum (count). Returns empty if it would be too costly.
+         */
+        static std::vector<double> sumDistribution(int count, int sides)
+        {
+            const double work = static_cast<double>(count) * count * (sides - 1) / 2.0;
+            if (work > maxSumTableWork) {
+                return {};
+            }
+
+            std::vector<double> distribution{1.0};
+            const double faceProbability = 1.0 / sides;
+
+            for (int die = 0; die < count; ++die) {
+                // Sliding-window sum: each new total is the mean of `sides` previous totals
+                std::vector<double> next(distribution.size() + sides - 1, 0.0);
+                double window = 0.0;
+                for (std::size_t total = 0; total < next.size(); ++total) {
+                    if (total < distribution.size()) {
+                        window += distribution[total];
+                    }
+                    if (total >= static_cast<std::size_t>(sides)) {
+                        window -= distribution[total - sides];
+                    }
+                    // Subtracting leaves rounding residue; in the far tails it can dip below zero
+                    next[total] = std::max(0.0, window) * faceProbability;
+                }
+                distribution.swap(next);
+            }
+            return distribution;
+        }
+
+        /**
+         * Distribution of the sum of the kept dice, offset so index 0 is the
+         * minimum (keep). Faces are visited from the kept end inward; the state
+         * is (dice assigned so far, kept total), and the first `keep` dice
+         * assigned are the kept ones. Returns empty if it would be too costly.
+         */
+        static std::vector<double> keepDistribution(const DiceTerm& term)
+        {
+            const int count = term.count;
+            const int sides = term.sides;
+            const int keep = term.keep;
+            const std::size_t totals = static_cast<std::size_t>(keep) * sides + 1;
+
+            const double work = static_cast<double>(sides) * count * count * totals / 2.0;
+            if (work > maxKeepTableWork) {
+                return {};
+            }
+
+            std::vector<std::vector<double>> binomial(count + 1, std::vector<double>(count + 1, 0.0));
+            for (int n = 0; n <= count; ++n) {
+                binomial[n][0] = 1.0;
+                for (int k = 1; k <= n; ++k) {
+                    binomial[n][k] = binomial[n - 1][k - 1] + (k <= n - 1 ? binomial[n - 1][k] : 0.0);
+                }
+            }
+
+            std::vector<double> facePowers(count + 1, 1.0);
+            for (int c = 1; c <= count; ++c) {
+                facePowers[c] = facePowers[c - 1] / sides;
+            }
+
+            // ways[assigned][total]
+            std::vector<std::vector<double>> ways(count + 1, std::vector<double>(totals, 0.0));
+            ways[0][0] = 1.0;
+
+            for (int step = 0; step < sides; ++step) {
+                const int face = term.keepHighest ? sides - step : step + 1;
+                const bool lastFace = step == sides - 1;
+                std::vector<std::vector<double>> next(count + 1, std::vector<double>(totals, 0.0));
+
+                for (int assigned = 0; assigned <= count; ++assigned) {
+                    const int remaining = count - assigned;
+                    const int keepSlots = std::max(0, keep - assigned);
+                    for (std::size_t total = 0; total < totals; ++total) {
+                        const double current = ways[assigned][total];
+                        if (current == 0.0) {
+                            continue;
+                        }
+                        // The last face must absorb every remaining die
+                        for (int showing = lastFace ? remaining : 0; showing <= remaining; ++showing) {
+                            const std::size_t keptTotal = total + static_cast<std::size_t>(std::min(showing, keepSlots)) * face;
+                            next[assigned + showing][keptTotal] +=
+                                current * binomial[remaining][showing] * facePowers[showing];
+                        }
+                    }
+                }
+                ways.swap(next);
+            }
+
+            // Drop the impossible totals below `keep`
+            return std::vector<double>(ways[count].begin() + keep, ways[count].end());
+        }
+
+        static std::vector<double> convolve(const std::vector<double>& a, const std::vector<double>& b)
+        {
+            std::vector<double> result(a.size() + b.size() - 1, 0.0);
+            for (std::size_t i = 0; i < a.size(); ++i) {
+                if (a[i] == 0.0) {
+                    continue;
+                }
+                for (std::size_t j = 0; j < b.size(); ++j) {
+                    result[i + j] += a[i] * b[j];
+                }
+            }
+            return result;
+        }
+
+        // Sampling without a table
+
+        template <typename Engine>
+        static std::int64_t rollTerm(const DiceTerm& term, Engine& engine)
+        {
+            const std::uint32_t sides = static_cast<std::uint32_t>(term.sides);
+            if (term.keep == term.count) {
+                std::int64_t total = term.count;  // Each die contributes 1 + [0, sides)
+                for (int die = 0; die < term.count; ++die) {
+                    total += detail::boundedRandom(engine, sides);
+                }
+                return total;
+            }
+
+            if (static_cast<std::uint32_t>(term.count) < sides) {
+                // Few dice on a big die: select the kept ones instead of clearing a counter per face
+                thread_local std::vector<std::uint32_t> faces;
+                faces.resize(static_cast<std::size_t>(term.count));
+                for (std::uint32_t& face : faces) {
+                    face = detail::boundedRandom(engine, sides);
+                }
+
+                const auto keptEnd = faces.begin() + term.keep;
+                if (term.keepHighest) {
+                    std::nth_element(faces.begin(), keptEnd, faces.end(), std::greater<std::uint32_t>());
+                } else {
+                    std::nth_element(faces.begin(), keptEnd, faces.end());
+                }
+                std::int64_t total = term.keep;  // Faces are stored zero-based
+                for (auto face = faces.begin(); face != keptEnd; ++face) {
+                    total += *face;
+                }
+                return total;
+            }
+
+            // Counting faces avoids sorting: walk from the kept end until `keep` dice are used
+            thread_local std::vector<std::uint32_t> faceCounts;
+            faceCounts.assign(sides, 0);
+            for (int die = 0; die < term.count; ++die) {
+                ++faceCounts[detail::boundedRandom(engine, sides)];
+            }
+
+            std::int64_t total = 0;
+            std::int64_t keepRemaining = term.keep;
+            for (std::uint32_t step = 0; step < sides && keepRemaining > 0; ++step) {
+                const std::uint32_t faceIndex = term.keepHighest ? sides - 1 - step : step;
+                const std::int64_t used = std::min<std::int64_t>(faceCounts[faceIndex], keepRemaining);
+                total += used * (faceIndex + 1);
+                keepRemaining -= used;
+            }
+            return total;
+        }
+
+        std::string expression_;
+        std::vector<DiceTerm> terms_;
+        std::int64_t constant_ = 0;
+        int minimum_ = 0;
+        int maximum_ = 0;
+        double expectedValue_ = 0.0;
+        std::vector<double> probabilities_;
+        AliasTable outcomeSampler_;
+    };
+} // namespace stevensMathLib
@@ -0,0 +1,495 @@
+/**
+ * stevensMathLib/distributions.h
+ *
+ * Binomial, Poisson and geometric samplers.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstdlib>
+#include <limits>
+#include <optional>
+#include <stdexcept>
+
+namespace stevensMathLib
+{
+    namespace detail
+    {
+        /**
+         * @brief log(Gamma(x)) for x >= 1 via a Stirling series
+         *
+         * Used instead of std::lgamma, which writes the global signgam and is
+         * the least consistent libm function across C libraries. The series
+         * still calls std::log, so results only match bit-for-bit where the
+         * libm is the same.
+         */
+        inline double logGamma(double x)
+        {
+            static constexpr double coefficients[10] = {
+                8.333333333333333e-02, -2.777777777777778e-03, 7.936507936507937e-04,
+                -5.952380952380952e-04, 8.417508417508418e-04, -1.917526917526918e-03,
+                6.410256410256410e-03, -2.955065359477124e-02, 1.796443723688307e-01,
+                -1.39243221690590e+00};
+            static constexpr double logTwoPi = 1.8378770664093453e+00;
+
+            if (x == 1.0 || x == 2.0) {
+                return 0.0;
+            }
+
+            // Shift small arguments up to 7 where the series is accurate
+            const int shift = x < 7.0 ? static_cast<int>(7.0 - x) : 0;
+            double shifted = x + shift;
+            const double inverseSquare = (1.0 / shifted) * (1.0 / shifted);
+
+            double series = coefficients[9];
+            for (int k = 8; k >= 0; --k) {
+                series = series * inverseSquare + coefficients[k];
+            }
+
+            double result = series / shifted + 0.5 * logTwoPi + (shifted - 0.5) * std::log(shifted) - shifted;
+            for (int k = 0; k < shift; ++k) {
+                shifted -= 1.0;
+                result -= std::log(shifted);
+            }
+            return result;
+        }
+
+        /**
+         * @brief Stirling series remainder log(Gamma(x)) - ((x - 0.5) log x - x + log(2 pi) / 2)
+         *
+         * The leading term is 1 / (12 x): 13860 / 166320 = 1 / 12.
+         */
+        inline double stirlingCorrection(double value)
+        {
+            const double square = value * value;
+            return (13860.0 - (462.0 - (132.0 - (99.0 - 140.0 / square) / square) / square) / square) /
+                   value / 166320.0;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Samples "how many of n independent trials with probability p succeed"
+     *
+     * Costs O(1) expected time regardless of the number of trials: small means
+     * (n * min(p, 1 - p) <= 30) use inversion, larger ones Kachitvichyanukul and
+     * Schmeiser's BTPE rejection algorithm. All setup constants are computed
+     * once in the constructor, so keep the sampler around when parameters repeat.
+     *
+     * Uses only raw engine output and the library's own uniform conversion,
+     * not std::binomial_distribution, so a given setSeed() produces the same
+     * counts across standard libraries that share a libm. The rejection tests
+     * call std::log, std::exp and std::sqrt, whose last-bit rounding can
+     * differ between C libraries.
+     */
+    class BinomialSampler
+    {
+    public:
+        /**
+         * @param trials Number of trials (n >= 0)
+         * @param probability Success probability of each trial, in [0, 1]
+         *
+         * @throws std::invalid_argument for a negative trial count or a probability outside [0, 1]
+         */
+        BinomialSampler(int trials, double probability)
+            : trials_(trials), probability_(probability)
+        {
+            if (trials < 0) {
+                throw std::invalid_argument("stevensMathLib::BinomialSampler - trials must be non-negative");
+            }
+            if (!(probability >= 0.0 && probability <= 1.0)) {
+                throw std::invalid_argument("stevensMathLib::BinomialSampler - probability must be in [0, 1]");
+            }
+
+            // Work with the smaller of p and 1 - p, then mirror the result
+            r_ = std::min(probability, 1.0 - probability);
+            q_ = 1.0 - r_;
+            useInversion_ = trials * r_ <= 30.0;
+
+            if (useInversion_) {
+                setUpInversion();
+            } else {
+                setUpBtpe();
+            }
+        }
+
+        int trials() const { return trials_; }
+        double probability() const { return probability_; }
+
+        template <typename Engine>
+        int operator()(Engine& engine) const
+        {
+            if (trials_ == 0 || r_ == 0.0) {
+                return probability_ > 0.5 ? trials_ : 0;
+            }
+
+            const int successes = useInversion_ ? sampleInversion(engine) : sampleBtpe(engine);
+            return probability_ > 0.5 ? trials_ - successes : successes;
+        }
+
+        /**
+         * @brief Draws a sample using getRandomEngine()
+         */
+        int sample() const
+        {
+            return (*this)(getRandomEngine());
+        }
+
+    private:
+        void setUpInversion()
+        {
+            zeroProbability_ = std::exp(trials_ * std::log(q_));
+            const double mean = trials_ * r_;
+            inversionBound_ = static_cast<int>(std::min(static_cast<double>(trials_),
+                                                        mean + 10.0 * std::sqrt(mean * q_ + 1.0)));
+        }
+
+        void setUpBtpe()
+        {
+            fm_ = trials_ * r_ + r_;
+            mode_ = static_cast<int>(std::floor(fm_));
+            p1_ = std::floor(2.195 * std::sqrt(trials_ * r_ * q_) - 4.6 * q_) + 0.5;
+            xm_ = mode_ + 0.5;
+            xl_ = xm_ - p1_;
+            xr_ = xm_ + p1_;
+            c_ = 0.134 + 20.5 / (15.3 + mode_);
+
+            double a = (fm_ - xl_) / (fm_ - xl_ * r_);
+            lambdaLeft_ = a * (1.0 + a / 2.0);
+            a = (xr_ - fm_) / (xr_ * q_);
+            lambdaRight_ = a * (1.0 + a / 2.0);
+
+            p2_ = p1_ * (1.0 + 2.0 * c_);
+            p3_ = p2_ + c_ / lambdaLeft_;
+            p4_ = p3_ + c_ / lambdaRight_;
+        }
+
+        template <typename Engine>
+        int sampleInversion(Engine& engine) const
+        {
+            int successes = 0;
+            double massAtSuccesses = zeroProbability_;
+            double u = detail::uniformOpenUnit(engine);
+
+            while (u > massAtSuccesses) {
+                ++successes;
+                if (successes > inversionBound_) {
+                    // Lost to rounding in the far tail: start over
+                    successes = 0;
+                    massAtSuccesses = zeroProbability_;
+                    u = detail::uniformOpenUnit(engine);
+                } else {
+                    u -= massAtSuccesses;
+                    massAtSuccesses = ((trials_ - successes + 1) * r_ * massAtSuccesses) / (successes * q_);
+                }
+            }
+            return successes;
+        }
+
+        /**
+         * BTPE: a triangle over the mode, parallelograms on either side and
+         * exponential tails. Most samples are accepted from the triangle with
+         * two uniforms; the rest go through a squeeze before an exact test.
+         */
+        template <typename Engine>
+        int sampleBtpe(Engine& engine) const
+        {
+            const double nrq = trials_ * r_ * q_;
+
+            while (true) {
+                const double u = detail::uniformOpenUnit(engine) * p4_;
+                double v = detail::uniformOpenUnit(engine);
+                int y = 0;
+
+                if (u <= p1_) {
+                    // Triangular region: accept immediately
+                    return static_cast<int>(std::floor(xm_ - p1_ * v + u));
+                }
+
+                if (u <= p2_) {
+                    const double x = xl_ + (u - p1_) / c_;
+                    v = v * c_ + 1.0 - std::abs(mode_ - x + 0.5) / p1_;
+                    if (v > 1.0) {
+                        continue;
+                    }
+                    y = static_cast<int>(std::floor(x));
+                } else if (u <= p3_) {
+                    const double x = std::floor(xl_ + std::log(v) / lambdaLeft_);
+                    if (x < 0.0) {
+                        continue;
+                    }
+                    y = static_cast<int>(x);
+                    v = v * (u - p2_) * lambdaLeft_;
+                } else {
+                    const double x = std::floor(xr_ - std::log(v) / lambdaRight_);
+                    if (x > trials_) {
+                        continue;
+                    }
+                    y = static_cast<int>(x);
+                    v = v * (u - p3_) * lambdaRight_;
+                }
+
+                const int distance = std::abs(y - mode_);
+                if (distance <= 20 || distance >= nrq / 2.0 - 1.0) {
+                    // Explicit ratio f(y) / f(mode) by recursion
+                    const double s = r_ / q_;
+                    const double a = s * (trials_ + 1);
+                    double ratio = 1.0;
+                    if (mode_ < y) {
+                        for (int i = mode_ + 1; i <= y; ++i) {
+                            ratio *= a / i - s;
+                        }
+                    } else if (mode_ > y) {
+                        for (int i = y + 1; i <= mode_; ++i) {
+                            ratio /= a / i - s;
+                        }
+                    }
+                    if (v <= ratio) {
+                        return y;
+                    }
+                    continue;
+                }
+
+                // Squeeze on log(f(y) / f(mode)), then the Stirling-based exact test
+                const double k = distance;
+                const double rho = (k / nrq) * ((k * (k / 3.0 + 0.625) + 0.16666666666666666) / nrq + 0.5);
+                const double t = -k * k / (2.0 * nrq);
+                const double logV = std::log(v);
+                if (logV < t - rho) {
+                    return y;
+                }
+                if (logV > t + rho) {
+                    continue;
+                }
+
+                const double x1 = y + 1.0;
+                const double f1 = mode_ + 1.0;
+                const double z = trials_ + 1.0 - mode_;
+                const double w = trials_ - y + 1.0;
+                const double bound = xm_ * std::log(f1 / x1) + (trials_ - mode_ + 0.5) * std::log(z / w) +
+                                     (y - mode_) * std::log(w * r_ / (x1 * q_)) +
+                                     detail::stirlingCorrection(f1) + detail::stirlingCorrection(z) +
+                                     detail::stirlingCorrection(x1) + detail::stirlingCorrection(w);
+                if (logV <= bound) {
+                    return y;
+                }
+            }
+        }
+
+        int trials_;
+        double probability_;
+        double r_ = 0.0;
+        double q_ = 1.0;
+        bool useInversion_ = true;
+
+        // Inversion constants
+        double zeroProbability_ = 1.0;
+        int inversionBound_ = 0;
+
+        // BTPE constants
+        double fm_ = 0.0;
+        int mode_ = 0;
+        double p1_ = 0.0, p2_ = 0.0, p3_ = 0.0, p4_ = 0.0;
+        double xm_ = 0.0, xl_ = 0.0, xr_ = 0.0, c_ = 0.0;
+        double lambdaLeft_ = 0.0, lambdaRight_ = 0.0;
+    };
+
+    /**
+     * @brief Samples a Poisson-distributed count with the given mean
+     *
+     * Costs O(1) expected time regardless of the mean: means below 10 use
+     * multiplication of uniforms, larger ones Hörmann's PTRS transformed
+     * rejection. Setup constants are computed once in the constructor.
+     */
+    class PoissonSampler
+    {
+    public:
+        /**
+         * @param mean Expected count (lambda >= 0)
+         *
+         * @throws std::invalid_argument if mean is negative, infinite or NaN
+         */
+        explicit PoissonSampler(double mean)
+            : mean_(mean)
+        {
+            if (!(mean >= 0.0) || std::isinf(mean)) {
+                throw std::invalid_argument("stevensMathLib::PoissonSampler - mean must be finite and non-negative");
+            }
+
+            expNegativeMean_ = std::exp(-mean);
+            logMean_ = std::log(mean);
+            const double rootMean = std::sqrt(mean);
+            b_ = 0.931 + 2.53 * rootMean;
+            a_ = -0.059 + 0.02483 * b_;
+            logInverseAlpha_ = std::log(1.1239 + 1.1328 / (b_ - 3.4));
+            vr_ = 0.9277 - 3.6224 / (b_ - 2.0);
+        }
+
+        double mean() const { return mean_; }
+
+        template <typename Engine>
+        std::int64_t operator()(Engine& engine) const
+        {
+            if (mean_ == 0.0) {
+                return 0;
+            }
+            return mean_ < ptrsThreshold ? sampleMultiplication(engine) : samplePtrs(engine);
+        }
+
+        /**
+         * @brief Draws a sample using getRandomEngine()
+         */
+        std::int64_t sample() const
+        {
+            return (*this)(getRandomEngine());
+        }
+
+    private:
+        static constexpr double ptrsThreshold = 10.0;
+
+        template <typename Engine>
+        std::int64_t sampleMultiplication(Engine& engine) const
+        {
+            std::int64_t count = 0;
+            double product = detail::uniformOpenUnit(engine);
+            while (product > expNegativeMean_) {
+                ++count;
+                product *= detail::uniformOpenUnit(engine);
+            }
+            return count;
+        }
+
+        template <typename Engine>
+        std::int64_t samplePtrs(Engine& engine) const
+        {
+            while (true) {
+                const double u = detail::uniformOpenUnit(engine) - 0.5;
+                const double v = detail::uniformOpenUnit(engine);
+                const double us = 0.5 - std::abs(u);
+                const double k = std::floor((2.0 * a_ / us + b_) * u + mean_ + 0.43);
+
+                if (us >= 0.07 && v <= vr_) {
+                    return static_cast<std::int64_t>(k);
+                }
+                if (k < 0.0 || (us < 0.013 && v > us)) {
+                    continue;
+                }
+                if (std::log(v) + logInverseAlpha_ - std::log(a_ / (us * us) + b_) <=
+                    -mean_ + k * logMean_ - detail::logGamma(k + 1.0)) {
+                    return static_cast<std::int64_t>(k);
+                }
+            }
+        }
+
+        double mean_;
+        double expNegativeMean_ = 1.0;
+        double logMean_ = 0.0;
+        double a_ = 0.0;
+        double b_ = 0.0;
+        double logInverseAlpha_ = 0.0;
+        double vr_ = 0.0;
+    };
+
+    /**
+     * @brief Samples the number of failures before the first success
+     *
+     * Same convention as std::geometric_distribution. Uses inversion, so every
+     * sample costs one uniform draw and one log regardless of p.
+     */
+    class GeometricSampler
+    {
+    public:
+        /**
+         * @param probability Success probability of each trial, in (0, 1]
+         *
+         * @throws std::invalid_argument if probability is outside (0, 1]
+         */
+        explicit GeometricSampler(double probability)
+            : probability_(probability)
+        {
+            if (!(probability > 0.0 && probability <= 1.0)) {
+                throw std::invalid_argument("stevensMathLib::GeometricSampler - probability must be in (0, 1]");
+            }
+            logFailure_ = std::log1p(-probability);
+        }
+
+        double probability() const { return probability_; }
+
+        template <typename Engine>
+        std::int64_t operator()(Engine& engine) const
+        {
+            if (probability_ == 1.0) {
+                return 0;
+            }
+
+            const double failures = std::floor(std::log(detail::uniformOpenUnit(engine)) / logFailure_);
+            const double maxFailures = static_cast<double>(std::numeric_limits<std::int64_t>::max() / 2);
+            return static_cast<std::int64_t>(std::min(failures, maxFailures));
+        }
+
+        /**
+         * @brief Draws a sample using getRandomEngine()
+         */
+        std::int64_t sample() const
+        {
+            return (*this)(getRandomEngine());
+        }
+
+    private:
+        double probability_;
+        double logFailure_;
+    };
+
+    /**
+     * @brief Number of successes in trials independent Bernoulli(probability) trials
+     *
+     * Replaces loops of `randomFloat() < p` with one O(1) call. The sampler for
+     * the most recent parameters is cached per thread, so repeated calls with
+     * the same arguments skip the setup.
+     *
+     * @throws std::invalid_argument for a negative trial count or a probability outside [0, 1]
+     */
+    inline int randomBinomial(int trials, double probability)
+    {
+        thread_local std::optional<BinomialSampler> cached;
+        if (!cached || cached->trials() != trials || cached->probability() != probability) {
+            cached.emplace(trials, probability);
+        }
+        return cached->sample();
+    }
+
+    /**
+     * @brief Poisson-distributed count with the given mean
+     *
+     * The sampler for the most recent mean is cached per thread.
+     *
+     * @throws std::invalid_argument if mean is negative, infinite or NaN
+     */
+    inline std::int64_t randomPoisson(double mean)
+    {
+        thread_local std::optional<PoissonSampler> cached;
+        if (!cached || cached->mean() != mean) {
+            cached.emplace(mean);
+        }
+        return cached->sample();
+    }
+
+    /**
+     * @brief Number of failures before the first success with the given probability
+     *
+     * @throws std::invalid_argument if probability is outside (0, 1]
+     */
+    inline std::int64_t randomGeometric(double probability)
+    {
+        return GeometricSampler(probability).sample();
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,243 @@
+/**
+ * stevensMathLib/format.h
+ *
+ * Allocation-free formatting of rounded values.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "decimal.h"
+#include "rounding.h"
+
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <type_traits>
+
+namespace stevensMathLib
+{
+    namespace detail
+    {
+        template <typename FloatType>
+        FloatType powerOf10AsFloat(int exponent)
+        {
+            static constexpr double powers[] = {
+                1e0, 1e1, 1e2, 1e3, 1e4, 1e5, 1e6, 1e7, 1e8, 1e9,
+                1e10, 1e11, 1e12, 1e13, 1e14, 1e15, 1e16, 1e17, 1e18
+            };
+            return static_cast<FloatType>(powers[exponent]);
+        }
+
+        /**
+         * @brief snprintf path for values the integer path cannot hold
+         *
+         * Formats into a scratch buffer first, so trimming happens before the
+         * fit check and the result may fill buffer exactly (snprintf would
+         * reserve a byte for the terminator). A double has at most 1074
+         * fraction digits, so any places beyond that are zeros and are
+         * appended rather than printed.
+         */
+        inline std::size_t formatRoundedFallback(char* buffer, std::size_t bufferSize, double value,
+                                                 int decimalPlaces, bool trimTrailingZeros)
+        {
+            static constexpr int maxSignificantPlaces = 1074;
+            char scratch[1 + 309 + 1 + maxSignificantPlaces + 1]; // Sign, DBL_MAX digits, point, fraction, NUL
+
+            const int printedPlaces = decimalPlaces < maxSignificantPlaces ? decimalPlaces : maxSignificantPlaces;
+            const int printed = std::snprintf(scratch, sizeof(scratch), "%.*f", printedPlaces, value);
+            if (printed < 0 || static_cast<std::size_t>(printed) >= sizeof(scratch)) {
+                return 0;
+            }
+
+            std::size_t length = static_cast<std::size_t>(printed);
+            std::size_t paddingZeros = static_cast<std::size_t>(decimalPlaces - printedPlaces);
+            const bool hasPoint = printedPlaces > 0 && std::isfinite(value);
+            if (trimTrailingZeros && hasPoint) {
+                paddingZeros = 0;
+                while (scratch[length - 1] == '0') {
+                    --length;
+                }
+                if (scratch[length - 1] == '.') {
+                    --length;
+                }
+            }
+
+            // Like the integer path, never write a negative zero
+            const char* text = scratch;
+            if (text[0] == '-' && std::isfinite(value)) {
+                bool allZero = true;
+                for (std::size_t i = 1; i < length && allZero; ++i) {
+                    allZero = text[i] == '0' || text[i] == '.';
+                }
+                if (allZero) {
+                    ++text;
+                    --length;
+                }
+            }
+
+            if (length + paddingZeros > bufferSize) {
+                return 0;
+            }
+            std::memcpy(buffer, text, length);
+            std::memset(buffer + length, '0', paddingZeros);
+            return length + paddingZeros;
+        }
+
+        /**
+         * @brief Shared implementation of formatRounded() and formatRoundedTrimmed()
+         *
+         * Rounds exactly like round(): scale in FloatType arithmetic, then
+         * std::round(). The resulting integer is printed directly, so no
+         * second float-to-decimal conversion is needed.
+         */
+        template <typename FloatType>
+        std::size_t formatRoundedImpl(char* buffer, std::size_t bufferSize, FloatType value,
+                                      int decimalPlaces, bool trimTrailingZeros,
+                                      const char* functionName)
+        {
+            static constexpr int maxFastDecimalPlaces = 18;
+            decimalPlaces = absolutePrecision(decimalPlaces, functionName);
+
+            const FloatType scaledValue = decimalPlaces <= maxFastDecimalPlaces
+                ? std::round(value * powerOf10AsFloat<FloatType>(decimalPlaces))
+                : FloatType(0);
+
+            // 2^64 is exactly representable; anything beyond (or NaN/inf) takes the slow path
+            const FloatType magnitudeLimit = static_cast<FloatType>(18446744073709551616.0);
+            const FloatType absoluteScaled = std::abs(scaledValue);
+            if (decimalPlaces > maxFastDecimalPlaces || !(absoluteScaled < magnitudeLimit)) {
+                return formatRoundedFallback(buffer, bufferSize, static_cast<double>(value), decimalPlaces,
+                                             trimTrailingZeros);
+            }
+
+            std::uint64_t magnitude = static_cast<std::uint64_t>(absoluteScaled);
+            if (trimTrailingZeros) {
+                while (decimalPlaces > 0 && magnitude % 10 == 0) {
+                    magnitude /= 10;
+                    --decimalPlaces;
+                }
+            }
+            return writeFixedPoint(buffer, bufferSize, magnitude,
+                                   scaledValue < 0 && magnitude != 0, decimalPlaces);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Rounds a value and writes it as fixed-point text in one step
+     *
+     * @param buffer Destination (not null-terminated)
+     * @param bufferSize Capacity of buffer in chars
+     * @param value The value to round and format
+     * @param decimalPlaces Digits after the decimal point (negative values are
+     *                      treated like round() treats them)
+     * @return Number of chars written, or 0 if the buffer is too small
+     *
+     * Produces the digits of round(value, decimalPlaces) without allocating or
+     * touching iostreams. Exactly decimalPlaces fraction digits are written.
+     *
+     * Example: formatRounded(buf, sizeof(buf), 3.14159f, 2) writes "3.14"
+     */
+    inline std::size_t formatRounded(char* buffer, std::size_t bufferSize,
+                                     float value, int decimalPlaces)
+    {
+        return detail::formatRoundedImpl(buffer, bufferSize, value, decimalPlaces,
+                                         false, "formatRounded()");
+    }
+
+    inline std::size_t formatRounded(char* buffer, std::size_t bufferSize,
+                                     double value, int decimalPlaces)
+    {
+        return detail::formatRoundedImpl(buffer, bufferSize, value, decimalPlaces,
+                                         false, "formatRounded()");
+    }
+
+    /**
+     * @brief Like formatRounded(), but drops trailing fraction zeros and a bare point
+     *
+     * @return Number of chars written, or 0 if the buffer is too small
+     *
+     * Example: formatRoundedTrimmed(buf, sizeof(buf), 2.50f, 2) writes "2.5",
+     *          formatRoundedTrimmed(buf, sizeof(buf), 2.999f, 2) writes "3"
+     */
+    inline std::size_t formatRoundedTrimmed(char* buffer, std::size_t bufferSize,
+                                            float value, int decimalPlaces)
+    {
+        return detail::formatRoundedImpl(buffer, bufferSize, value, decimalPlaces,
+                                         true, "formatRoundedTrimmed()");
+    }
+
+    inline std::size_t formatRoundedTrimmed(char* buffer, std::size_t bufferSize,
+                                            double value, int decimalPlaces)
+    {
+        return detail::formatRoundedImpl(buffer, bufferSize, value, decimalPlaces,
+                                         true, "formatRoundedTrimmed()");
+    }
+
+    /**
+     * @brief Formats the display value produced by roundToNearest10th()
+     *
+     * @return Number of chars written, or 0 if the buffer is too small
+     *
+     * Writes "3.1" for 3.14f and "3" for 2.96f, matching roundToNearest10th().
+     */
+    inline std::size_t formatNearest10th(char* buffer, std::size_t bufferSize, float value)
+    {
+        return formatRoundedTrimmed(buffer, bufferSize, value, 1);
+    }
+
+    /**
+     * @brief Result of a batch formatting call
+     */
+    struct FormatBatchResult
+    {
+        std::size_t bytesWritten;   // Chars written to the buffer, including separators
+        std::size_t valuesWritten;  // Values that fit; the rest were not written
+    };
+
+    /**
+     * @brief Rounds and formats many values into one contiguous buffer
+     *
+     * @param values Pointer to the values to format
+     * @param count Number of values
+     * @param decimalPlaces Digits after the decimal point
+     * @param buffer Destination (not null-terminated)
+     * @param bufferSize Capacity of buffer in chars
+     * @param separator Char written after every value
+     * @param trimTrailingZeros Use formatRoundedTrimmed() semantics instead of formatRounded()
+     * @return How many bytes and values were written; stops at the first value that doesn't fit
+     */
+    template <typename FloatType>
+    FormatBatchResult formatRoundedBatch(const FloatType* values, std::size_t count,
+                                         int decimalPlaces, char* buffer, std::size_t bufferSize,
+                                         char separator = '\n', bool trimTrailingZeros = false)
+    {
+        static_assert(std::is_floating_point<FloatType>::value,
+                      "formatRoundedBatch requires a floating point value type");
+
+        decimalPlaces = detail::absolutePrecision(decimalPlaces, "formatRoundedBatch()");
+
+        FormatBatchResult result{0, 0};
+        for (; result.valuesWritten < count; ++result.valuesWritten) {
+            const std::size_t remaining = bufferSize - result.bytesWritten;
+            const std::size_t written = detail::formatRoundedImpl(
+                buffer + result.bytesWritten, remaining, values[result.valuesWritten],
+                decimalPlaces, trimTrailingZeros, "formatRoundedBatch()");
+
+            if (written == 0 || written >= remaining) {
+                break;
+            }
+
+            buffer[result.bytesWritten + written] = separator;
+            result.bytesWritten += written + 1;
+        }
+        return result;
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,620 @@
+/**
+ * stevensMathLib/half.h
+ *
+ * Float16 (IEEE binary16) and BFloat16 storage types, with scalar and batch
+ * conversions from float under a selectable rounding mode.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "config.h"
+#include "random.h"
+#include "rounding.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+#include <immintrin.h>
+#endif
+
+namespace stevensMathLib
+{
+    /**
+     * @brief How a float is rounded when it is narrowed to 16 bits
+     */
+    enum class HalfRounding
+    {
+        NearestEven,    // IEEE default; ties go to the even neighbour
+        TowardZero,     // Truncate; overflow saturates to the largest finite value
+        Stochastic      // Round up with probability equal to the discarded fraction
+    };
+
+    /**
+     * @brief IEEE 754 binary16: 1 sign, 5 exponent and 10 mantissa bits
+     *
+     * A storage type: convert with toFloat16() and toFloat(). Whole numbers
+     * up to 2048 are exact; the largest finite value is 65504.
+     */
+    struct Float16
+    {
+        std::uint16_t bits = 0;
+    };
+
+    /**
+     * @brief Brain float: the top 16 bits of a float (8 exponent, 7 mantissa bits)
+     *
+     * Same range as float with about 2-3 significant decimal digits.
+     */
+    struct BFloat16
+    {
+        std::uint16_t bits = 0;
+    };
+
+    static_assert(sizeof(Float16) == 2 && sizeof(BFloat16) == 2, "half types must be 16 bits");
+
+    namespace detail
+    {
+        inline std::uint32_t floatBits(float value)
+        {
+            std::uint32_t bits;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        inline float floatFromBits(std::uint32_t bits)
+        {
+            float value;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        /**
+         * @brief Rounds a float to binary16 bits
+         *
+         * The kept bits are truncated first; remainder is the discarded
+         * fraction of one binary16 ulp scaled to 32 bits, which each mode
+         * turns into a 0 or 1 increment. Carries propagate through the exponent,
+         * so 0x7BFF + 1 correctly becomes infinity.
+         *
+         * @param random Uniform 32-bit value, only read for Stochastic
+         */
+        inline std::uint16_t floatToHalfBits(float value, HalfRounding rounding, std::uint32_t random)
+        {
+            const std::uint32_t bits = floatBits(value);
+            const std::uint32_t sign = (bits >> 16) & 0x8000u;
+            const std::uint32_t magnitude = bits & 0x7FFFFFFFu;
+
+            if (magnitude >= 0x7F800000u) {
+                // Infinity, or NaN quietened with the top of its payload kept
+                const std::uint32_t mantissa = magnitude & 0x007FFFFFu;
+                return static_cast<std::uint16_t>(sign | 0x7C00u | (mantissa != 0 ? 0x0200u | (mantissa >> 13) : 0u));
+            }
+            if (magnitude >= 0x47800000u) {
+                // 65536 and above: past every finite binary16
+                return static_cast<std::uint16_t>(sign | (rounding == HalfRounding::TowardZero ? 0x7BFFu : 0x7C00u));
+            }
+
+            const std::uint32_t exponentField = magnitude >> 23;
+            std::uint32_t half;
+            std::uint32_t remainder;
+            if (exponentField >= 127 - 14) {
+                // Normal binary16
+                half = ((exponentField - 127 + 15) << 10) | ((magnitude >> 13) & 0x3FFu);
+                remainder = magnitude << 19;
+            } else {
+                // Subnormal binary16 (or zero): units of 2^-24
+                const std::uint32_t significand = exponentField != 0 ? (magnitude & 0x007FFFFFu) | 0x00800000u
+                                                                     : magnitude;
+                const std::uint32_t shift = exponentField != 0 ? 126 - exponentField : 125;
+                half = shift < 32 ? significand >> shift : 0;
+                remainder = shift <= 32 ? significand << (32 - shift)
+                                        : (shift < 64 ? significand >> (shift - 32) : 0);
+            }
+
+            std::uint32_t increment = 0;
+            if (rounding == HalfRounding::NearestEven) {
+                increment = (remainder > 0x80000000u) | ((remainder == 0x80000000u) & (half & 1u));
+            } else if (rounding == HalfRounding::Stochastic) {
+                increment = random < remainder;
+            }
+            return static_cast<std::uint16_t>(sign | ((half + increment) & 0x7FFFu));
+        }
+
+        inline float halfBitsToFloat(std::uint16_t half)
+        {
+            const std::uint32_t sign = static_cast<std::uint32_t>(half & 0x8000u) << 16;
+            const std::uint32_t exponent = (half >> 10) & 0x1Fu;
+            const std::uint32_t mantissa = half & 0x3FFu;
+
+            if (exponent == 0x1F) {
+                return floatFromBits(sign | 0x7F800000u | (mantissa << 13));
+            }
+            if (exponent == 0) {
+                // Zero or subnormal: mantissa * 2^-24, exact in float
+                return floatFromBits(sign | floatBits(static_cast<float>(mantissa) * (1.0f / 16777216.0f)));
+            }
+            return floatFromBits(sign | ((exponent + 127 - 15) << 23) | (mantissa << 13));
+        }
+
+        /**
+         * @brief Rounds a float to bfloat16 bits by adding an increment below bit 16
+         */
+        inline std::uint16_t floatToBFloat16Bits(float value, HalfRounding rounding, std::uint32_t random)
+        {
+            const std::uint32_t bits = floatBits(value);
+
+            std::uint32_t increment = 0;
+            if (rounding == HalfRounding::NearestEven) {
+                increment = 0x7FFFu + ((bits >> 16) & 1u);
+            } else if (rounding == HalfRounding::Stochastic) {
+                increment = random >> 16;
+            }
+            // NaN is quietened instead, so a payload only in the low half
+            // cannot round or truncate to infinity. A select, not a branch,
+            // so the batch loops vectorize.
+            const bool isNaN = (bits & 0x7FFFFFFFu) > 0x7F800000u;
+            const std::uint32_t rounded = isNaN ? (bits >> 16) | 0x0040u : (bits + increment) >> 16;
+            return static_cast<std::uint16_t>(rounded);
+        }
+
+        inline float bfloat16BitsToFloat(std::uint16_t bits)
+        {
+            return floatFromBits(static_cast<std::uint32_t>(bits) << 16);
+        }
+
+        /**
+         * @brief Stochastic rounding for a batch: two 32-bit draws per SplitMix64 step
+         *
+         * The stream is seeded with one getRandomEngine() word per batch call,
+         * so setSeed() reproduces it, and the engine is not called per value.
+         */
+        template <typename Half, typename Convert>
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void narrowStochastic(const float* values, Half* out, std::size_t count, std::uint64_t seed,
+                                     Convert convert)
+        {
+            std::size_t i = 0;
+            for (; i + 2 <= count; i += 2) {
+                const std::uint64_t random = splitMix64(seed);
+                out[i].bits = convert(values[i], HalfRounding::Stochastic, static_cast<std::uint32_t>(random));
+                out[i + 1].bits = convert(values[i + 1], HalfRounding::Stochastic, static_cast<std::uint32_t>(random >> 32));
+            }
+            if (i < count) {
+                out[i].bits = convert(values[i], HalfRounding::Stochastic, static_cast<std::uint32_t>(splitMix64(seed)));
+            }
+        }
+
+        /**
+         * @brief Batch bfloat16 narrowing for one deterministic rounding mode
+         *
+         * Pure integer arithmetic, so it vectorizes on every target. As in
+         * range_math.h, the fixed-size block loop is what GCC's cheap -O2
+         * vectorizer accepts; the tail runs scalar.
+         */
+        template <HalfRounding Rounding>
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void narrowBFloat16Blocks(const float* __restrict values, BFloat16* __restrict out, std::size_t count)
+        {
+            constexpr std::size_t block = 16;
+
+            std::size_t i = 0;
+            for (; i + block <= count; i += block) {
+                for (std::size_t j = 0; j < block; ++j) {
+                    out[i + j].bits = floatToBFloat16Bits(values[i + j], Rounding, 0);
+                }
+            }
+            for (; i < count; ++i) {
+                out[i].bits = floatToBFloat16Bits(values[i], Rounding, 0);
+            }
+        }
+
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void floatToBFloat16Body(const float* __restrict values, BFloat16* __restrict out, std::size_t count,
+                                        HalfRounding rounding, std::uint64_t seed)
+        {
+            if (rounding == HalfRounding::Stochastic) {
+                narrowStochastic(values, out, count, seed, floatToBFloat16Bits);
+            } else if (rounding == HalfRounding::TowardZero) {
+                narrowBFloat16Blocks<HalfRounding::TowardZero>(values, out, count);
+            } else {
+                narrowBFloat16Blocks<HalfRounding::NearestEven>(values, out, count);
+            }
+        }
+
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void bfloat16ToFloatBody(const BFloat16* __restrict values, float* __restrict out, std::size_t count)
+        {
+            constexpr std::size_t block = 16;
+
+            std::size_t i = 0;
+            for (; i + block <= count; i += block) {
+                for (std::size_t j = 0; j < block; ++j) {
+                    out[i + j] = bfloat16BitsToFloat(values[i + j].bits);
+                }
+            }
+            for (; i < count; ++i) {
+                out[i] = bfloat16BitsToFloat(values[i].bits);
+            }
+        }
+
+        inline void floatToHalfScalar(const float* values, Float16* out, std::size_t count,
+                                      HalfRounding rounding, std::uint64_t seed)
+        {
+            if (rounding == HalfRounding::Stochastic) {
+                narrowStochastic(values, out, count, seed, floatToHalfBits);
+                return;
+            }
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i].bits = floatToHalfBits(values[i], rounding, 0);
+            }
+        }
+
+        inline void halfToFloatScalar(const Float16* values, float* out, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = halfBitsToFloat(values[i].bits);
+            }
+        }
+
+        inline void floatToBFloat16Scalar(const float* values, BFloat16* out, std::size_t count,
+                                          HalfRounding rounding, std::uint64_t seed)
+        {
+            floatToBFloat16Body(values, out, count, rounding, seed);
+        }
+
+        inline void bfloat16ToFloatScalar(const BFloat16* values, float* out, std::size_t count)
+        {
+            bfloat16ToFloatBody(values, out, count);
+        }
+
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        // F16C converts 8 values per instruction with the rounding mode as an
+        // immediate; stochastic rounding has no hardware form and stays scalar.
+        __attribute__((target("avx2,f16c"))) inline void floatToHalfF16c(const float* values, Float16* out,
+                                                                          std::size_t count, HalfRounding rounding,
+                                                                          std::uint64_t seed)
+        {
+            if (rounding == HalfRounding::Stochastic) {
+                narrowStochastic(values, out, count, seed, floatToHalfBits);
+                return;
+            }
+            std::size_t i = 0;
+            if (rounding == HalfRounding::TowardZero) {
+                for (; i + 8 <= count; i += 8) {
+                    const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+                }
+            } else {
+                for (; i + 8 <= count; i += 8) {
+                    const __m128i half = _mm256_cvtps_ph(_mm256_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                    _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), half);
+                }
+            }
+            for (; i < count; ++i) {
+                out[i].bits = floatToHalfBits(values[i], rounding, 0);
+            }
+        }
+
+        __attribute__((target("avx2,f16c"))) inline void halfToFloatF16c(const Float16* values, float* out,
+                                                                          std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 8 <= count; i += 8) {
+                const __m128i half = _mm_loadu_si128(reinterpret_cast<const __m128i*>(values + i));
+                _mm256_storeu_ps(out + i, _mm256_cvtph_ps(half));
+            }
+            for (; i < count; ++i) {
+                out[i] = halfBitsToFloat(values[i].bits);
+            }
+        }
+
+        __attribute__((target("avx2,f16c"))) inline void floatToBFloat16Avx2(const float* values, BFloat16* out,
+                                                                              std::size_t count, HalfRounding rounding,
+                                                                              std::uint64_t seed)
+        {
+            floatToBFloat16Body(values, out, count, rounding, seed);
+        }
+
+        __attribute__((target("avx2,f16c"))) inline void bfloat16ToFloatAvx2(const BFloat16* values, float* out,
+                                                                              std::size_t count)
+        {
+            bfloat16ToFloatBody(values, out, count);
+        }
+
+        // GCC 12 reports the intrinsics' deliberately undefined passthrough
+        // operand as maybe-uninitialized once they are inlined
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wmaybe-uninitialized"
+#endif
+        // AVX-512 doubles the width. Its BF16 extension is not used: its
+        // conversion flushes subnormals to zero, unlike the integer kernel.
+        __attribute__((target("avx512f,avx512bw"))) inline void floatToHalfAvx512(const float* values, Float16* out,
+                                                                                    std::size_t count,
+                                                                                    HalfRounding rounding,
+                                                                                    std::uint64_t seed)
+        {
+            if (rounding == HalfRounding::Stochastic) {
+                narrowStochastic(values, out, count, seed, floatToHalfBits);
+                return;
+            }
+            std::size_t i = 0;
+            if (rounding == HalfRounding::TowardZero) {
+                for (; i + 16 <= count; i += 16) {
+                    const __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(values + i), _MM_FROUND_TO_ZERO | _MM_FROUND_NO_EXC);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), half);
+                }
+            } else {
+                for (; i + 16 <= count; i += 16) {
+                    const __m256i half = _mm512_cvtps_ph(_mm512_loadu_ps(values + i), _MM_FROUND_TO_NEAREST_INT | _MM_FROUND_NO_EXC);
+                    _mm256_storeu_si256(reinterpret_cast<__m256i*>(out + i), half);
+                }
+            }
+            for (; i < count; ++i) {
+                out[i].bits = floatToHalfBits(values[i], rounding, 0);
+            }
+        }
+
+        __attribute__((target("avx512f,avx512bw"))) inline void halfToFloatAvx512(const Float16* values, float* out,
+                                                                                    std::size_t count)
+        {
+            std::size_t i = 0;
+            for (; i + 16 <= count; i += 16) {
+                const __m256i half = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(values + i));
+                _mm512_storeu_ps(out + i, _mm512_cvtph_ps(half));
+            }
+            for (; i < count; ++i) {
+                out[i] = halfBitsToFloat(values[i].bits);
+            }
+        }
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+
+        __attribute__((target("avx512f,avx512bw"))) inline void floatToBFloat16Avx512(const float* values,
+                                                                                        BFloat16* out,
+                                                                                        std::size_t count,
+                                                                                        HalfRounding rounding,
+                                                                                        std::uint64_t seed)
+        {
+            floatToBFloat16Body(values, out, count, rounding, seed);
+        }
+
+        __attribute__((target("avx512f,avx512bw"))) inline void bfloat16ToFloatAvx512(const BFloat16* values,
+                                                                                        float* out, std::size_t count)
+        {
+            bfloat16ToFloatBody(values, out, count);
+        }
+#endif
+
+        enum class HalfKernel
+        {
+            Scalar,
+            F16c,
+            Avx512
+        };
+
+        inline HalfKernel halfKernel()
+        {
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+            static const HalfKernel kernel = [] {
+                __builtin_cpu_init();
+                if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+                    return HalfKernel::Avx512;
+                }
+                if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+                    return HalfKernel::F16c;
+                }
+                return HalfKernel::Scalar;
+            }();
+            return kernel;
+#else
+            return HalfKernel::Scalar;
+#endif
+        }
+
+        // Only stochastic rounding consumes engine output
+        inline std::uint64_t stochasticSeed(HalfRounding rounding)
+        {
+            return rounding == HalfRounding::Stochastic ? randomWord64() : 0;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Name of the kernel the half batch functions run on: "avx512", "f16c" or "scalar"
+     */
+    inline const char* activeHalfKernel()
+    {
+        switch (detail::halfKernel()) {
+        case detail::HalfKernel::Avx512:
+            return "avx512";
+        case detail::HalfKernel::F16c:
+            return "f16c";
+        default:
+            return "scalar";
+        }
+    }
+
+    /**
+     * @brief Converts a float to Float16
+     *
+     * @param value The value to convert
+     * @param rounding NearestEven (default), TowardZero, or Stochastic, which
+     *                 draws one value from getRandomEngine()
+     * @return The nearest Float16 in the chosen direction; values past 65504
+     *         become infinity (TowardZero saturates to 65504 instead)
+     */
+    inline Float16 toFloat16(float value, HalfRounding rounding = HalfRounding::NearestEven)
+    {
+        const std::uint32_t random = rounding == HalfRounding::Stochastic
+                                         ? static_cast<std::uint32_t>(getRandomEngine()())
+                                         : 0;
+        return Float16{detail::floatToHalfBits(value, rounding, random)};
+    }
+
+    /**
+     * @brief Converts a float to BFloat16; see toFloat16() for the rounding modes
+     */
+    inline BFloat16 toBFloat16(float value, HalfRounding rounding = HalfRounding::NearestEven)
+    {
+        const std::uint32_t random = rounding == HalfRounding::Stochastic
+                                         ? static_cast<std::uint32_t>(getRandomEngine()())
+                                         : 0;
+        return BFloat16{detail::floatToBFloat16Bits(value, rounding, random)};
+    }
+
+    /**
+     * @brief Exact widening conversion back to float
+     */
+    inline float toFloat(Float16 value)
+    {
+        return detail::halfBitsToFloat(value.bits);
+    }
+
+    inline float toFloat(BFloat16 value)
+    {
+        return detail::bfloat16BitsToFloat(value.bits);
+    }
+
+    /**
+     * @brief Converts count floats to Float16
+     *
+     * NearestEven and TowardZero give exactly the toFloat16() results, using
+     * F16C or AVX-512 when the CPU has them (activeHalfKernel()). Stochastic
+     * draws one seed from getRandomEngine() per call and expands it with
+     * SplitMix64, so it is reproducible after setSeed() but not identical to
+     * count toFloat16() calls.
+     *
+     * @param values Pointer to the floats to convert
+     * @param out Destination for count values; must not overlap values
+     * @param count Number of values
+     * @param rounding Rounding mode
+     */
+    inline void toFloat16Batch(const float* values, Float16* out, std::size_t count,
+                               HalfRounding rounding = HalfRounding::NearestEven)
+    {
+        const std::uint64_t seed = detail::stochasticSeed(rounding);
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        switch (detail::halfKernel()) {
+        case detail::HalfKernel::Avx512:
+            detail::floatToHalfAvx512(values, out, count, rounding, seed);
+            return;
+        case detail::HalfKernel::F16c:
+            detail::floatToHalfF16c(values, out, count, rounding, seed);
+            return;
+        default:
+            break;
+        }
+#endif
+        detail::floatToHalfScalar(values, out, count, rounding, seed);
+    }
+
+    /**
+     * @brief Converts count floats to BFloat16; see toFloat16Batch()
+     */
+    inline void toBFloat16Batch(const float* values, BFloat16* out, std::size_t count,
+                                HalfRounding rounding = HalfRounding::NearestEven)
+    {
+        const std::uint64_t seed = detail::stochasticSeed(rounding);
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        switch (detail::halfKernel()) {
+        case detail::HalfKernel::Avx512:
+            detail::floatToBFloat16Avx512(values, out, count, rounding, seed);
+            return;
+        case detail::HalfKernel::F16c:
+            detail::floatToBFloat16Avx2(values, out, count, rounding, seed);
+            return;
+        default:
+            break;
+        }
+#endif
+        detail::floatToBFloat16Scalar(values, out, count, rounding, seed);
+    }
+
+    /**
+     * @brief Widens count Float16 values to float
+     */
+    inline void toFloatBatch(const Float16* values, float* out, std::size_t count)
+    {
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        switch (detail::halfKernel()) {
+        case detail::HalfKernel::Avx512:
+            detail::halfToFloatAvx512(values, out, count);
+            return;
+        case detail::HalfKernel::F16c:
+            detail::halfToFloatF16c(values, out, count);
+            return;
+        default:
+            break;
+        }
+#endif
+        detail::halfToFloatScalar(values, out, count);
+    }
+
+    /**
+     * @brief Widens count BFloat16 values to float
+     */
+    inline void toFloatBatch(const BFloat16* values, float* out, std::size_t count)
+    {
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        switch (detail::halfKernel()) {
+        case detail::HalfKernel::Avx512:
+            detail::bfloat16ToFloatAvx512(values, out, count);
+            return;
+        case detail::HalfKernel::F16c:
+            detail::bfloat16ToFloatAvx2(values, out, count);
+            return;
+        default:
+            break;
+        }
+#endif
+        detail::bfloat16ToFloatScalar(values, out, count);
+    }
+
+    /**
+     * @brief Checks if a half-precision value has no fractional part
+     */
+    inline bool isWholeNumber(Float16 value)
+    {
+        return isWholeNumber(toFloat(value));
+    }
+
+    inline bool isWholeNumber(BFloat16 value)
+    {
+        return isWholeNumber(toFloat(value));
+    }
+
+    /**
+     * @brief Rounds to decimal places, then to the nearest Float16
+     *
+     * Most decimal fractions are not representable in 16 bits, so e.g.
+     * round(toFloat16(3.14159f), 2) is the Float16 closest to 3.14 (3.140625).
+     */
+    inline Float16 round(Float16 value, int decimalPlaces)
+    {
+        return toFloat16(round(toFloat(value), decimalPlaces));
+    }
+
+    /**
+     * @brief Rounds to decimal places, then to the nearest BFloat16
+     */
+    inline BFloat16 round(BFloat16 value, int decimalPlaces)
+    {
+        return toBFloat16(round(toFloat(value), decimalPlaces));
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,206 @@
+/**
+ * stevensMathLib/instrumentation.h
+ *
+ * Opt-in counters for the library's slow paths.
+ *
+ * Define STEVENSMATHLIB_ENABLE_INSTRUMENTATION for the whole program (e.g.
+ * with target_compile_definitions) so every translation unit agrees on these
+ * inline definitions. Without it each hook is an empty inline function and
+ * instrumentationSnapshot() returns zeros.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+#if defined(STEVENSMATHLIB_ENABLE_INSTRUMENTATION)
+#include <atomic>
+#include <mutex>
+#include <vector>
+#endif
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Events counted when STEVENSMATHLIB_ENABLE_INSTRUMENTATION is defined
+     */
+    enum class InstrumentationCounter : std::size_t
+    {
+        BlacklistCalls,          // randomIntNotInBlacklist() calls
+        BlacklistRejections,     // candidates rejected because they were blacklisted
+        BlacklistFallbacks,      // calls that fell back to building the O(range) valid list
+        FloatToIntCalls,         // floatToInt() and floatToInteger() calls
+        FloatToIntOutOfRange,    // floatToInt()/floatToInteger() values that did not fit
+        RoundCalls,              // round() calls
+        NegativePrecision,       // negative decimal place counts corrected (round, formatting)
+        Count
+    };
+
+    /**
+     * @brief Stable metric name for a counter, e.g. "blacklist.rejections"
+     */
+    inline const char* instrumentationCounterName(InstrumentationCounter counter)
+    {
+        static const char* const names[] = {
+            "blacklist.calls",
+            "blacklist.rejections",
+            "blacklist.fallbacks",
+            "float_to_int.calls",
+            "float_to_int.out_of_range",
+            "round.calls",
+            "round.negative_precision",
+        };
+        static_assert(sizeof(names) / sizeof(names[0]) == static_cast<std::size_t>(InstrumentationCounter::Count),
+                      "every InstrumentationCounter needs a name");
+        return names[static_cast<std::size_t>(counter)];
+    }
+
+    /**
+     * @brief Process-wide counter totals at one point in time
+     *
+     * Subtract two snapshots to get the events in between, which is what most
+     * metrics exporters want:
+     *
+     *   InstrumentationSnapshot previous = instrumentationSnapshot();
+     *   ...
+     *   InstrumentationSnapshot delta = instrumentationSnapshot() - previous;
+     *   for (std::size_t i = 0; i < InstrumentationSnapshot::size; ++i) {
+     *       auto counter = static_cast<InstrumentationCounter>(i);
+     *       metrics.add(instrumentationCounterName(counter), delta[counter]);
+     *   }
+     */
+    struct InstrumentationSnapshot
+    {
+        static constexpr std::size_t size = static_cast<std::size_t>(InstrumentationCounter::Count);
+
+        std::uint64_t counts[size] = {};
+
+        std::uint64_t operator[](InstrumentationCounter counter) const
+        {
+            return counts[static_cast<std::size_t>(counter)];
+        }
+
+        InstrumentationSnapshot operator-(const InstrumentationSnapshot& earlier) const
+        {
+            InstrumentationSnapshot delta;
+            for (std::size_t i = 0; i < size; ++i) {
+                delta.counts[i] = counts[i] - earlier.counts[i];
+            }
+            return delta;
+        }
+    };
+
+#if defined(STEVENSMATHLIB_ENABLE_INSTRUMENTATION)
+    inline constexpr bool instrumentationEnabled = true;
+
+    namespace detail
+    {
+        /**
+         * @brief One thread's counters; only the owning thread writes them
+         *
+         * Single-writer, so an increment is a relaxed load and store rather
+         * than a locked read-modify-write, and readers never block the writer.
+         */
+        struct ThreadInstrumentation
+        {
+            std::atomic<std::uint64_t> counts[InstrumentationSnapshot::size] = {};
+
+            ThreadInstrumentation();
+            ~ThreadInstrumentation();
+        };
+
+        /**
+         * @brief Live per-thread blocks plus totals folded in from exited threads
+         */
+        struct InstrumentationRegistry
+        {
+            std::mutex mutex;
+            std::vector<ThreadInstrumentation*> threads;
+            InstrumentationSnapshot retired;
+        };
+
+        inline InstrumentationRegistry& instrumentationRegistry()
+        {
+            static InstrumentationRegistry registry;
+            return registry;
+        }
+
+        inline ThreadInstrumentation::ThreadInstrumentation()
+        {
+            InstrumentationRegistry& registry = instrumentationRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            registry.threads.push_back(this);
+        }
+
+        inline ThreadInstrumentation::~ThreadInstrumentation()
+        {
+            InstrumentationRegistry& registry = instrumentationRegistry();
+            std::lock_guard<std::mutex> lock(registry.mutex);
+            for (std::size_t i = 0; i < InstrumentationSnapshot::size; ++i) {
+                registry.retired.counts[i] += counts[i].load(std::memory_order_relaxed);
+            }
+            for (std::size_t i = 0; i < registry.threads.size(); ++i) {
+                if (registry.threads[i] == this) {
+                    registry.threads[i] = registry.threads.back();
+                    registry.threads.pop_back();
+                    break;
+                }
+            }
+        }
+
+        inline ThreadInstrumentation& threadInstrumentation()
+        {
+            thread_local ThreadInstrumentation instrumentation;
+            return instrumentation;
+        }
+
+        inline void countEvent(InstrumentationCounter counter, std::uint64_t amount = 1)
+        {
+            std::atomic<std::uint64_t>& count =
+                threadInstrumentation().counts[static_cast<std::size_t>(counter)];
+            count.store(count.load(std::memory_order_relaxed) + amount, std::memory_order_relaxed);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Sums every thread's counters, including threads that have exited
+     *
+     * Takes a mutex shared only with thread start/exit, never with the counting
+     * fast path. Counts from other threads may lag by a few events.
+     */
+    inline InstrumentationSnapshot instrumentationSnapshot()
+    {
+        detail::InstrumentationRegistry& registry = detail::instrumentationRegistry();
+        std::lock_guard<std::mutex> lock(registry.mutex);
+
+        InstrumentationSnapshot snapshot = registry.retired;
+        for (const detail::ThreadInstrumentation* thread : registry.threads) {
+            for (std::size_t i = 0; i < InstrumentationSnapshot::size; ++i) {
+                snapshot.counts[i] += thread->counts[i].load(std::memory_order_relaxed);
+            }
+        }
+        return snapshot;
+    }
+#else
+    inline constexpr bool instrumentationEnabled = false;
+
+    namespace detail
+    {
+        inline void countEvent(InstrumentationCounter, std::uint64_t = 1) {}
+    } // namespace detail
+
+    /**
+     * @brief All zeros: define STEVENSMATHLIB_ENABLE_INSTRUMENTATION to count events
+     */
+    inline InstrumentationSnapshot instrumentationSnapshot()
+    {
+        return InstrumentationSnapshot{};
+    }
+#endif
+} // namespace stevensMathLib
@@ -0,0 +1,291 @@
+/**
+ * stevensMathLib/interval.h
+ *
+ * Interval and IntervalIndex for stabbing queries over many ranges.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "range.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <optional>
+#include <vector>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief A range as accepted by in_range(), for use with IntervalIndex
+     */
+    template <typename T>
+    struct Interval
+    {
+        T lowerBound;
+        T upperBound;
+        BoundType boundType = BoundType::Inclusive;
+    };
+
+    /**
+     * @brief Static index answering "which ranges contain this value?" in O(log n + k)
+     *
+     * @tparam T The numeric type (must support comparison operators)
+     *
+     * Built once from a list of intervals; each interval's id is its position in
+     * that list. A match means in_range(value, lowerBound, upperBound, boundType)
+     * would return true, so inclusive and exclusive ranges can be mixed freely.
+     *
+     * Internally this is a centered interval tree flattened into contiguous
+     * arrays. Every node stores the intervals straddling its center twice,
+     * sorted by lower bound and by upper bound, so a query walks one root-to-leaf
+     * path and only touches intervals that actually match.
+     *
+     * Example:
+     *   IntervalIndex<int> rules({{0, 10}, {5, 15, BoundType::Exclusive}});
+     *   rules.findAll(7);    // {0, 1}
+     *   rules.findFirst(12); // 1
+     */
+    template <typename T>
+    class IntervalIndex
+    {
+    public:
+        IntervalIndex() = default;
+
+        /**
+         * @brief Builds the index
+         *
+         * @param intervals The ranges to index; empty ranges never match
+         */
+        explicit IntervalIndex(const std::vector<Interval<T>>& intervals)
+            : intervalCount_(intervals.size())
+        {
+            std::vector<Entry> entries;
+            entries.reserve(intervals.size());
+            for (std::size_t id = 0; id < intervals.size(); ++id) {
+                const Interval<T>& interval = intervals[id];
+                const bool exclusive = interval.boundType == BoundType::Exclusive;
+                const bool isEmpty = exclusive ? !(interval.lowerBound < interval.upperBound)
+                                               : !(interval.lowerBound <= interval.upperBound);
+                if (!isEmpty) {
+                    entries.push_back({interval.lowerBound, interval.upperBound, id, exclusive});
+                }
+            }
+
+            byLower_.reserve(entries.size());
+            byUpper_.reserve(entries.size());
+            buildNode(entries);
+        }
+
+        /**
+         * @brief Number of intervals the index was built from (including empty ones)
+         */
+        std::size_t size() const { return intervalCount_; }
+
+        /**
+         * @brief Appends the id of every interval containing value to matches
+         *
+         * Ids are appended in no particular order. Reusing the same vector
+         * across calls avoids allocation.
+         */
+        void findAll(const T& value, std::vector<std::size_t>& matches) const
+        {
+            visitMatches(value, [&matches](std::size_t id) { matches.push_back(id); });
+        }
+
+        /**
+         * @brief Returns the ids of every interval containing value
+         */
+        std::vector<std::size_t> findAll(const T& value) const
+        {
+            std::vector<std::size_t> matches;
+            findAll(value, matches);
+            return matches;
+        }
+
+        /**
+         * @brief Returns the lowest id of any interval containing value
+         *
+         * Useful when interval order encodes priority (first matching rule wins).
+         */
+        std::optional<std::size_t> findFirst(const T& value) const
+        {
+            std::optional<std::size_t> first;
+            visitMatches(value, [&first](std::size_t id) {
+                if (!first || id < *first) {
+                    first = id;
+                }
+            });
+            return first;
+        }
+
+        /**
+         * @brief Returns how many intervals contain value
+         */
+        std::size_t countMatches(const T& value) const
+        {
+            std::size_t count = 0;
+            visitMatches(value, [&count](std::size_t) { ++count; });
+            return count;
+        }
+
+        /**
+         * @brief Queries many values at once, writing results in CSR form
+         *
+         * @param values Pointer to the values to look up
+         * @param count Number of values
+         * @param offsets Receives count + 1 entries; the matches for values[i]
+         *                are ids[offsets[i]] up to ids[offsets[i + 1]]
+         * @param ids Receives the matching interval ids
+         */
+        void findAllBatch(const T* values, std::size_t count,
+                          std::vector<std::size_t>& offsets,
+                          std::vector<std::size_t>& ids) const
+        {
+            offsets.clear();
+            ids.clear();
+            offsets.reserve(count + 1);
+            offsets.push_back(0);
+
+            for (std::size_t i = 0; i < count; ++i) {
+                findAll(values[i], ids);
+                offsets.push_back(ids.size());
+            }
+        }
+
+    private:
+        struct Entry
+        {
+            T lowerBound;
+            T upperBound;
+            std::size_t id;
+            bool exclusive;
+
+            bool lowerAccepts(const T& value) const
+            {
+                return exclusive ? lowerBound < value : lowerBound <= value;
+            }
+
+            bool upperAccepts(const T& value) const
+            {
+                return exclusive ? value < upperBound : value <= upperBound;
+            }
+        };
+
+        struct Node
+        {
+            T center;
+            std::size_t begin;  // Range of this node's entries in byLower_ and byUpper_
+            std::size_t end;
+            std::size_t left;
+            std::size_t right;
+        };
+
+        static constexpr std::size_t noChild = std::numeric_limits<std::size_t>::max();
+
+        /**
+         * Splits entries around the median endpoint. That endpoint belongs to
+         * at least one entry, so every node is non-empty and recursion ends.
+         */
+        std::size_t buildNode(std::vector<Entry>& entries)
+        {
+            if (entries.empty()) {
+                return noChild;
+            }
+
+            std::vector<T> endpoints;
+            endpoints.reserve(entries.size() * 2);
+            for (const Entry& entry : entries) {
+                endpoints.push_back(entry.lowerBound);
+                endpoints.push_back(entry.upperBound);
+            }
+            const auto median = endpoints.begin() + endpoints.size() / 2;
+            std::nth_element(endpoints.begin(), median, endpoints.end());
+            const T center = *median;
+
+            std::vector<Entry> leftEntries;
+            std::vector<Entry> rightEntries;
+            std::vector<Entry> centerEntries;
+            for (const Entry& entry : entries) {
+                if (entry.upperBound < center) {
+                    leftEntries.push_back(entry);
+                } else if (center < entry.lowerBound) {
+                    rightEntries.push_back(entry);
+                } else {
+                    centerEntries.push_back(entry);
+                }
+            }
+            entries.clear();
+            entries.shrink_to_fit();
+
+            const std::size_t nodeIndex = nodes_.size();
+            nodes_.push_back({center, byLower_.size(), byLower_.size() + centerEntries.size(),
+                              noChild, noChild});
+
+            // Inclusive bounds accept more values, so they sort first on ties;
+            // this keeps the accepted entries a prefix of each list.
+            std::sort(centerEntries.begin(), centerEntries.end(), [](const Entry& a, const Entry& b) {
+                if (a.lowerBound < b.lowerBound || b.lowerBound < a.lowerBound) {
+                    return a.lowerBound < b.lowerBound;
+                }
+                return !a.exclusive && b.exclusive;
+            });
+            byLower_.insert(byLower_.end(), centerEntries.begin(), centerEntries.end());
+
+            std::sort(centerEntries.begin(), centerEntries.end(), [](const Entry& a, const Entry& b) {
+                if (a.upperBound < b.upperBound || b.upperBound < a.upperBound) {
+                    return b.upperBound < a.upperBound;
+                }
+                return !a.exclusive && b.exclusive;
+            });
+            byUpper_.insert(byUpper_.end(), centerEntries.begin(), centerEntries.end());
+
+            const std::size_t left = buildNode(leftEntries);
+            const std::size_t right = buildNode(rightEntries);
+            nodes_[nodeIndex].left = left;
+            nodes_[nodeIndex].right = right;
+            return nodeIndex;
+        }
+
+        template <typename Visitor>
+        void visitMatches(const T& value, Visitor&& visit) const
+        {
+            std::size_t nodeIndex = nodes_.empty() ? noChild : 0;
+
+            while (nodeIndex != noChild) {
+                const Node& node = nodes_[nodeIndex];
+
+                if (value < node.center) {
+                    // Every entry here reaches the center, so only the lower bound can fail
+                    for (std::size_t i = node.begin; i < node.end && byLower_[i].lowerAccepts(value); ++i) {
+                        visit(byLower_[i].id);
+                    }
+                    nodeIndex = node.left;
+                } else if (node.center < value) {
+                    for (std::size_t i = node.begin; i < node.end && byUpper_[i].upperAccepts(value); ++i) {
+                        visit(byUpper_[i].id);
+                    }
+                    nodeIndex = node.right;
+                } else {
+                    // value == center (or unordered, e.g. NaN): children cannot match
+                    for (std::size_t i = node.begin; i < node.end && byLower_[i].lowerAccepts(value); ++i) {
+                        if (byLower_[i].upperAccepts(value)) {
+                            visit(byLower_[i].id);
+                        }
+                    }
+                    nodeIndex = noChild;
+                }
+            }
+        }
+
+        std::size_t intervalCount_ = 0;
+        std::vector<Node> nodes_;
+        std::vector<Entry> byLower_;
+        std::vector<Entry> byUpper_;
+    };
+} // namespace stevensMathLib
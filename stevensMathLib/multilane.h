@@ -0,0 +1,303 @@
+/**
+ * stevensMathLib/multilane.h
+ *
+ * MultiLaneEngine: interleaved xoshiro256++ lanes for bulk generation.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "config.h"
+#include "random.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+
+namespace stevensMathLib
+{
+    namespace detail
+    {
+        /**
+         * @brief Advances Lanes interleaved xoshiro256++ states by `blocks` steps
+         *
+         * State is laid out word-major (all lanes' s0, then s1, ...), so every
+         * statement of the update is a straight loop over lanes that compilers
+         * turn into SIMD adds, shifts and xors. Lanes are processed in groups
+         * of 8 (one AVX-512 register per state word) so a group's state stays
+         * in registers across blocks. Writes Lanes values per block.
+         */
+        template <std::size_t Lanes>
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void xoshiroLanes(std::uint64_t* state, std::uint64_t* out, std::size_t blocks)
+        {
+            constexpr std::size_t group = Lanes % 8 == 0 ? 8 : Lanes;
+
+            for (std::size_t first = 0; first < Lanes; first += group) {
+                alignas(64) std::uint64_t s0[group];
+                alignas(64) std::uint64_t s1[group];
+                alignas(64) std::uint64_t s2[group];
+                alignas(64) std::uint64_t s3[group];
+                std::memcpy(s0, state + first, sizeof(s0));
+                std::memcpy(s1, state + Lanes + first, sizeof(s1));
+                std::memcpy(s2, state + 2 * Lanes + first, sizeof(s2));
+                std::memcpy(s3, state + 3 * Lanes + first, sizeof(s3));
+
+                for (std::size_t block = 0; block < blocks; ++block) {
+                    std::uint64_t* output = out + block * Lanes + first;
+                    for (std::size_t lane = 0; lane < group; ++lane) {
+                        const std::uint64_t sum = s0[lane] + s3[lane];
+                        output[lane] = ((sum << 23) | (sum >> 41)) + s0[lane];
+
+                        const std::uint64_t t = s1[lane] << 17;
+                        s2[lane] ^= s0[lane];
+                        s3[lane] ^= s1[lane];
+                        s1[lane] ^= s2[lane];
+                        s0[lane] ^= s3[lane];
+                        s2[lane] ^= t;
+                        s3[lane] = (s3[lane] << 45) | (s3[lane] >> 19);
+                    }
+                }
+
+                std::memcpy(state + first, s0, sizeof(s0));
+                std::memcpy(state + Lanes + first, s1, sizeof(s1));
+                std::memcpy(state + 2 * Lanes + first, s2, sizeof(s2));
+                std::memcpy(state + 3 * Lanes + first, s3, sizeof(s3));
+            }
+        }
+
+        template <std::size_t Lanes>
+        void xoshiroLanesScalar(std::uint64_t* state, std::uint64_t* out, std::size_t blocks)
+        {
+            xoshiroLanes<Lanes>(state, out, blocks);
+        }
+
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        template <std::size_t Lanes>
+        __attribute__((target("avx2"))) void xoshiroLanesAvx2(std::uint64_t* state, std::uint64_t* out,
+                                                              std::size_t blocks)
+        {
+            xoshiroLanes<Lanes>(state, out, blocks);
+        }
+
+        template <std::size_t Lanes>
+        __attribute__((target("avx512f"))) void xoshiroLanesAvx512(std::uint64_t* state, std::uint64_t* out,
+                                                                   std::size_t blocks)
+        {
+            xoshiroLanes<Lanes>(state, out, blocks);
+        }
+#endif
+    } // namespace detail
+
+    /**
+     * @brief Lanes independent xoshiro256++ generators advanced in lockstep
+     *
+     * A single engine produces one value per call through a serial dependency
+     * chain. This one keeps Lanes states interleaved so one step yields Lanes
+     * 64-bit values from SIMD registers, for bulk integer and float generation.
+     * The kernel is compiled for AVX-512, AVX2 and baseline x86/other targets
+     * and picked once at runtime from the CPU's features; all kernels produce
+     * identical output.
+     *
+     * Lanes are seeded by expanding one 64-bit seed with SplitMix64, so the
+     * default constructor (which draws that seed from getRandomEngine()) is
+     * reproducible under setSeed().
+     *
+     * Satisfies UniformRandomBitGenerator.
+     */
+    template <std::size_t Lanes = 8>
+    class MultiLaneEngine
+    {
+        static_assert(Lanes >= 1 && Lanes <= 64, "MultiLaneEngine supports 1 to 64 lanes");
+
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        /**
+         * @brief Seeds all lanes from getRandomEngine()
+         */
+        MultiLaneEngine()
+            : MultiLaneEngine(detail::randomWord64())
+        {
+        }
+
+        /**
+         * @brief Seeds all lanes from one 64-bit seed
+         *
+         * Lane i's state words are SplitMix64 outputs 4i .. 4i+3 of the seed.
+         */
+        explicit MultiLaneEngine(std::uint64_t seed)
+        {
+            std::uint64_t expander = seed;
+            for (std::size_t lane = 0; lane < Lanes; ++lane) {
+                for (std::size_t word = 0; word < 4; ++word) {
+                    state_[word * Lanes + lane] = detail::splitMix64(expander);
+                }
+            }
+        }
+
+        /**
+         * @brief Name of the kernel selected for this CPU: "avx512", "avx2" or "scalar"
+         */
+        static const char* activeKernel()
+        {
+            return kernel().name;
+        }
+
+        /**
+         * @brief Next 64-bit value (drains one step's worth of lanes at a time)
+         */
+        result_type operator()()
+        {
+            if (bufferPosition_ == Lanes) {
+                kernel().function(state_, buffer_, 1);
+                bufferPosition_ = 0;
+            }
+            return buffer_[bufferPosition_++];
+        }
+
+        /**
+         * @brief Writes count 64-bit values
+         *
+         * Values continue the same sequence operator() produces.
+         */
+        void fill(std::uint64_t* out, std::size_t count)
+        {
+            while (count > 0 && bufferPosition_ < Lanes) {
+                *out++ = buffer_[bufferPosition_++];
+                --count;
+            }
+
+            const std::size_t blocks = count / Lanes;
+            if (blocks > 0) {
+                kernel().function(state_, out, blocks);
+                out += blocks * Lanes;
+                count -= blocks * Lanes;
+            }
+
+            while (count > 0) {
+                *out++ = (*this)();
+                --count;
+            }
+        }
+
+        /**
+         * @brief Writes count floats in [lowerBound, upperBound]
+         *
+         * Each 64-bit value supplies two 24-bit fractions, mapped with the same
+         * formula as randomFloat().
+         */
+        void fillFloats(float* out, std::size_t count, float lowerBound = 0.0f, float upperBound = 1.0f)
+        {
+            const double span = static_cast<float>(upperBound - lowerBound);
+            const double lower = lowerBound;
+            std::uint64_t words[chunkSize];
+
+            while (count > 0) {
+                const std::size_t pairs = std::min(chunkSize, (count + 1) / 2);
+                fill(words, pairs);
+
+                const std::size_t produced = std::min(count, pairs * 2);
+                const std::size_t fullPairs = produced / 2;
+                for (std::size_t pair = 0; pair < fullPairs; ++pair) {
+                    out[2 * pair] = unitToFloat(words[pair] >> 40, lower, span);
+                    out[2 * pair + 1] = unitToFloat((words[pair] >> 8) & 0xFFFFFFu, lower, span);
+                }
+                if (produced % 2 != 0) {
+                    out[produced - 1] = unitToFloat(words[fullPairs] >> 40, lower, span);
+                }
+                out += produced;
+                count -= produced;
+            }
+        }
+
+        /**
+         * @brief Writes count integers in [lowerBound, upperBound)
+         *
+         * Each 64-bit value supplies two 32-bit draws mapped with Lemire's
+         * method; the rare rejected draw is replaced from operator().
+         * If upperBound <= lowerBound, every element is lowerBound.
+         */
+        void fillInts(int* out, std::size_t count, int lowerBound, int upperBound)
+        {
+            if (upperBound <= lowerBound) {
+                std::fill(out, out + count, lowerBound);
+                return;
+            }
+
+            const std::uint32_t range =
+                static_cast<std::uint32_t>(static_cast<std::int64_t>(upperBound) - lowerBound);
+            const std::uint32_t threshold = static_cast<std::uint32_t>(0u - range) % range;
+            std::uint64_t words[chunkSize];
+
+            while (count > 0) {
+                const std::size_t pairs = std::min(chunkSize, (count + 1) / 2);
+                fill(words, pairs);
+
+                const std::size_t produced = std::min(count, pairs * 2);
+                for (std::size_t i = 0; i < produced; ++i) {
+                    const std::uint64_t word = words[i / 2] >> (i % 2 == 0 ? 32 : 0);
+                    std::uint64_t product = (word & 0xFFFFFFFFu) * range;
+                    while (static_cast<std::uint32_t>(product) < threshold) {
+                        product = ((*this)() >> 32) * range;
+                    }
+                    out[i] = static_cast<int>(static_cast<std::int64_t>(lowerBound) +
+                                              static_cast<std::int64_t>(product >> 32));
+                }
+                out += produced;
+                count -= produced;
+            }
+        }
+
+    private:
+        static constexpr std::size_t chunkSize = 256;
+
+        static float unitToFloat(std::uint64_t bits24, double lower, double span)
+        {
+            return static_cast<float>(lower + span * (static_cast<double>(bits24) * (1.0 / 16777216.0)));
+        }
+
+        using KernelFunction = void (*)(std::uint64_t*, std::uint64_t*, std::size_t);
+
+        struct Kernel
+        {
+            KernelFunction function;
+            const char* name;
+        };
+
+        static const Kernel& kernel()
+        {
+            static const Kernel selected = selectKernel();
+            return selected;
+        }
+
+        static Kernel selectKernel()
+        {
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx512f")) {
+                return {&detail::xoshiroLanesAvx512<Lanes>, "avx512"};
+            }
+            if (__builtin_cpu_supports("avx2")) {
+                return {&detail::xoshiroLanesAvx2<Lanes>, "avx2"};
+            }
+#endif
+            return {&detail::xoshiroLanesScalar<Lanes>, "scalar"};
+        }
+
+        alignas(64) std::uint64_t state_[4 * Lanes];
+        alignas(64) std::uint64_t buffer_[Lanes] = {};
+        std::size_t bufferPosition_ = Lanes;
+    };
+} // namespace stevensMathLib
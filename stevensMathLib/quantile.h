@@ -0,0 +1,595 @@
+/**
+ * stevensMathLib/quantile.h
+ *
+ * QuantileSketch: a bounded-memory, mergeable quantile sketch.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Bounded-memory, mergeable quantile sketch for unbounded streams
+     *
+     * Implements the KLL sketch (Karnin, Lang, Liberty): values are kept in a
+     * stack of compactors whose capacities shrink geometrically toward the
+     * bottom. When the sketch fills up, the lowest full compactor is sorted and
+     * every other item is promoted one level up with doubled weight. Memory
+     * stays O(k) regardless of stream length, and the normalized rank error of
+     * any quantile query is roughly normalizedRankError().
+     *
+     * Compaction coin flips come from a small generator owned by the sketch,
+     * seeded with one draw from getRandomEngine() at construction, so setSeed()
+     * still makes sketch contents reproducible while inserts and merges leave
+     * the caller's random sequence untouched.
+     *
+     * Example:
+     *   QuantileSketch latencies;
+     *   latencies.insert(samples.begin(), samples.end());
+     *   double p99 = latencies.quantile(0.99);
+     */
+    class QuantileSketch
+    {
+    public:
+        static constexpr std::uint16_t defaultK = 200;
+        static constexpr std::uint16_t minimumK = 8;
+        // Level weights are 1 << level in a uint64_t
+        static constexpr std::size_t maxLevels = 63;
+
+        /**
+         * @brief Creates an empty sketch
+         *
+         * @param k Accuracy parameter; larger k means more memory and less error
+         *
+         * @throws std::invalid_argument if k is smaller than minimumK
+         */
+        explicit QuantileSketch(std::uint16_t k = defaultK)
+            : k_(k),
+              coinState_(detail::randomWord64())
+        {
+            if (k < minimumK) {
+                throw std::invalid_argument(
+                    "stevensMathLib::QuantileSketch - k must be at least 8");
+            }
+            levels_.emplace_back();
+            totalCapacity_ = computeTotalCapacity();
+        }
+
+        /**
+         * @brief Creates a sketch sized for a target normalized rank error
+         *
+         * @param rankError Desired rank error as a fraction (e.g. 0.01 for 1%)
+         * @return A sketch whose normalizedRankError() is at most rankError
+         *
+         * @throws std::invalid_argument if rankError is not in (0, 1)
+         */
+        static QuantileSketch withRankError(double rankError)
+        {
+            if (!(rankError > 0.0 && rankError < 1.0)) {
+                throw std::invalid_argument(
+                    "stevensMathLib::QuantileSketch - rankError must be in (0, 1)");
+            }
+
+            for (std::uint32_t k = minimumK; k <= std::numeric_limits<std::uint16_t>::max(); ++k) {
+                if (rankErrorForK(static_cast<std::uint16_t>(k)) <= rankError) {
+                    return QuantileSketch(static_cast<std::uint16_t>(k));
+                }
+            }
+            return QuantileSketch(std::numeric_limits<std::uint16_t>::max());
+        }
+
+        /**
+         * @brief Approximate normalized rank error (99% confidence) for a given k
+         *
+         * Empirical fit published with the Apache DataSketches KLL implementation.
+         */
+        static double rankErrorForK(std::uint16_t k)
+        {
+            return 2.296 / std::pow(static_cast<double>(k), 0.9723);
+        }
+
+        /**
+         * @brief Adds a single value to the sketch
+         *
+         * NaN values are ignored since they have no rank.
+         */
+        void insert(double value)
+        {
+            if (std::isnan(value)) {
+                return;
+            }
+
+            updateMinMax(value);
+            levels_[0].push_back(value);
+            ++count_;
+            ++retained_;
+
+            if (retained_ > totalCapacity_) {
+                compress();
+            }
+        }
+
+        /**
+         * @brief Adds every value in [first, last) to the sketch
+         *
+         * Accepts any iterator whose value converts to double, so float and
+         * integer buffers can be fed without an intermediate copy.
+         */
+        template <typename InputIt>
+        void insert(InputIt first, InputIt last)
+        {
+            for (; first != last; ++first) {
+                insert(static_cast<double>(*first));
+            }
+        }
+
+        /**
+         * @brief Folds another sketch into this one
+         *
+         * @param other A sketch built over a disjoint part of the stream
+         *
+         * Sketches may come from different threads or nodes; the result answers
+         * queries over the union of both streams. If k differs, the smaller k
+         * (and therefore the larger error) wins. Merging a sketch into itself
+         * counts every value twice.
+         */
+        void merge(const QuantileSketch& other)
+        {
+            if (other.count_ == 0) {
+                return;
+            }
+            if (&other == this) {
+                // Inserting a level into itself would read from a range it is growing
+                const QuantileSketch copy(other);
+                merge(copy);
+                return;
+            }
+
+            if (count_ == 0) {
+                minValue_ = other.minValue_;
+                maxValue_ = other.maxValue_;
+            }
+            minValue_ = std::min(minValue_, other.minValue_);
+            maxValue_ = std::max(maxValue_, other.maxValue_);
+            count_ += other.count_;
+            k_ = std::min(k_, other.k_);
+
+            if (levels_.size() < other.levels_.size()) {
+                levels_.resize(other.levels_.size());
+            }
+            totalCapacity_ = computeTotalCapacity();
+            retained_ += other.retained_;
+
+            levels_[0].insert(levels_[0].end(), other.levels_[0].begin(), other.levels_[0].end());
+            for (std::size_t level = 1; level < other.levels_.size(); ++level) {
+                mergeSortedInto(levels_[level], other.levels_[level]);
+            }
+
+            compress();
+        }
+
+        /**
+         * @brief Returns the approximate value at a normalized rank
+         *
+         * @param fraction Rank in [0, 1]; 0.5 is the median, 0.99 is p99
+         * @return The estimated quantile, or NaN if the sketch is empty
+         *
+         * @throws std::invalid_argument if fraction is outside [0, 1]
+         */
+        double quantile(double fraction) const
+        {
+            return quantiles(std::vector<double>{fraction}).front();
+        }
+
+        /**
+         * @brief Returns several quantiles while sorting the retained items once
+         *
+         * @param fractions Ranks in [0, 1]
+         * @return One estimated value per requested fraction (NaN if empty)
+         *
+         * @throws std::invalid_argument if any fraction is outside [0, 1]
+         */
+        std::vector<double> quantiles(const std::vector<double>& fractions) const
+        {
+            for (const double fraction : fractions) {
+                if (!(fraction >= 0.0 && fraction <= 1.0)) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::QuantileSketch - fraction must be in [0, 1]");
+                }
+            }
+
+            std::vector<double> results(fractions.size(),
+                                        std::numeric_limits<double>::quiet_NaN());
+            if (count_ == 0) {
+                return results;
+            }
+
+            const std::vector<WeightedItem> sortedView = buildSortedView();
+            for (std::size_t i = 0; i < fractions.size(); ++i) {
+                results[i] = quantileFromView(sortedView, fractions[i]);
+            }
+            return results;
+        }
+
+        /**
+         * @brief Returns the approximate fraction of values less than or equal to value
+         *
+         * @return Normalized rank in [0, 1], or NaN if the sketch is empty
+         */
+        double rank(double value) const
+        {
+            if (count_ == 0) {
+                return std::numeric_limits<double>::quiet_NaN();
+            }
+
+            std::uint64_t weightBelow = 0;
+            for (std::size_t level = 0; level < levels_.size(); ++level) {
+                const std::uint64_t weight = std::uint64_t{1} << level;
+                for (const double item : levels_[level]) {
+                    if (item <= value) {
+                        weightBelow += weight;
+                    }
+                }
+            }
+            return static_cast<double>(weightBelow) / static_cast<double>(count_);
+        }
+
+        /**
+         * @brief Serializes the sketch into a compact little-endian byte buffer
+         */
+        std::vector<std::uint8_t> serialize() const
+        {
+            std::vector<std::uint8_t> bytes;
+            bytes.reserve(serializedHeaderSize + levels_.size() * 4 + retainedItems() * 8);
+
+            // GCC 12 loses track of the reserve() above and warns that the
+            // insert can write past an empty buffer
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic push
+#pragma GCC diagnostic ignored "-Wstringop-overflow"
+#endif
+            bytes.insert(bytes.end(), std::begin(serialMagic), std::end(serialMagic));
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic pop
+#endif
+            bytes.push_back(serialVersion);
+            writeLittleEndian(bytes, k_);
+            bytes.push_back(static_cast<std::uint8_t>(levels_.size()));
+            writeLittleEndian(bytes, count_);
+            writeLittleEndian(bytes, doubleBits(minValue_));
+            writeLittleEndian(bytes, doubleBits(maxValue_));
+
+            for (const std::vector<double>& level : levels_) {
+                writeLittleEndian(bytes, static_cast<std::uint32_t>(level.size()));
+                for (const double item : level) {
+                    writeLittleEndian(bytes, doubleBits(item));
+                }
+            }
+            return bytes;
+        }
+
+        /**
+         * @brief Reconstructs a sketch produced by serialize()
+         *
+         * @param data Pointer to the serialized bytes
+         * @param size Number of bytes available
+         * @return The reconstructed sketch
+         *
+         * @throws std::invalid_argument if the buffer is truncated or malformed,
+         *         including level counts above maxLevels, NaN or unsorted items,
+         *         and a stored count that disagrees with the retained weight
+         */
+        static QuantileSketch deserialize(const std::uint8_t* data, std::size_t size)
+        {
+            ByteReader reader{data, size};
+
+            for (const std::uint8_t expected : serialMagic) {
+                if (reader.read<std::uint8_t>() != expected) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::QuantileSketch - bad serialization magic");
+                }
+            }
+            if (reader.read<std::uint8_t>() != serialVersion) {
+                throw std::invalid_argument(
+                    "stevensMathLib::QuantileSketch - unsupported serialization version");
+            }
+
+            QuantileSketch sketch(reader.read<std::uint16_t>());
+            const std::uint8_t levelCount = reader.read<std::uint8_t>();
+            if (levelCount == 0) {
+                throw std::invalid_argument(
+                    "stevensMathLib::QuantileSketch - serialized sketch has no levels");
+            }
+            if (levelCount > maxLevels) {
+                throw std::invalid_argument(
+                    "stevensMathLib::QuantileSketch - serialized sketch has too many levels");
+            }
+
+            sketch.count_ = reader.read<std::uint64_t>();
+            sketch.minValue_ = bitsToDouble(reader.read<std::uint64_t>());
+            sketch.maxValue_ = bitsToDouble(reader.read<std::uint64_t>());
+            sketch.levels_.assign(levelCount, {});
+
+            std::uint64_t retainedWeight = 0;
+            for (std::size_t levelIndex = 0; levelIndex < levelCount; ++levelIndex) {
+                std::vector<double>& level = sketch.levels_[levelIndex];
+                const std::uint32_t levelSize = reader.read<std::uint32_t>();
+                if (levelSize > reader.remaining() / 8) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::QuantileSketch - truncated serialized sketch");
+                }
+                level.reserve(levelSize);
+                for (std::uint32_t i = 0; i < levelSize; ++i) {
+                    const double item = bitsToDouble(reader.read<std::uint64_t>());
+                    if (std::isnan(item)) {
+                        throw std::invalid_argument(
+                            "stevensMathLib::QuantileSketch - serialized sketch contains NaN");
+                    }
+                    level.push_back(item);
+                }
+                // Only level 0 is an unsorted buffer; higher levels are merged, not re-sorted
+                if (levelIndex > 0 && !std::is_sorted(level.begin(), level.end())) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::QuantileSketch - serialized level is not sorted");
+                }
+
+                const std::uint64_t remainingWeight =
+                    std::numeric_limits<std::uint64_t>::max() - retainedWeight;
+                if (levelSize > (remainingWeight >> levelIndex)) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::QuantileSketch - serialized count does not match its items");
+                }
+                retainedWeight += std::uint64_t{levelSize} << levelIndex;
+                sketch.retained_ += levelSize;
+            }
+            if (retainedWeight != sketch.count_) {
+                throw std::invalid_argument(
+                    "stevensMathLib::QuantileSketch - serialized count does not match its items");
+            }
+            sketch.totalCapacity_ = sketch.computeTotalCapacity();
+            return sketch;
+        }
+
+        static QuantileSketch deserialize(const std::vector<std::uint8_t>& bytes)
+        {
+            return deserialize(bytes.data(), bytes.size());
+        }
+
+        std::uint64_t count() const { return count_; }
+        bool empty() const { return count_ == 0; }
+        std::uint16_t k() const { return k_; }
+        double normalizedRankError() const { return rankErrorForK(k_); }
+
+        /**
+         * @brief Smallest value seen (NaN if empty)
+         */
+        double min() const
+        {
+            return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : minValue_;
+        }
+
+        /**
+         * @brief Largest value seen (NaN if empty)
+         */
+        double max() const
+        {
+            return count_ == 0 ? std::numeric_limits<double>::quiet_NaN() : maxValue_;
+        }
+
+        /**
+         * @brief Number of values currently stored (the sketch's memory footprint)
+         */
+        std::size_t retainedItems() const { return retained_; }
+
+    private:
+        struct WeightedItem
+        {
+            double value;
+            std::uint64_t weight;
+        };
+
+        struct ByteReader
+        {
+            const std::uint8_t* data;
+            std::size_t size;
+            std::size_t offset = 0;
+
+            std::size_t remaining() const { return size - offset; }
+
+            template <typename UnsignedType>
+            UnsignedType read()
+            {
+                if (remaining() < sizeof(UnsignedType)) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::QuantileSketch - truncated serialized sketch");
+                }
+
+                UnsignedType value = 0;
+                for (std::size_t byte = 0; byte < sizeof(UnsignedType); ++byte) {
+                    value |= static_cast<UnsignedType>(
+                        static_cast<UnsignedType>(data[offset + byte]) << (8 * byte));
+                }
+                offset += sizeof(UnsignedType);
+                return value;
+            }
+        };
+
+        static constexpr std::uint8_t serialMagic[3] = {'K', 'L', 'L'};
+        static constexpr std::uint8_t serialVersion = 1;
+        static constexpr std::size_t serializedHeaderSize = 3 + 1 + 2 + 1 + 8 + 8 + 8;
+        static constexpr std::size_t minimumLevelCapacity = 8;
+
+        template <typename UnsignedType>
+        static void writeLittleEndian(std::vector<std::uint8_t>& bytes, UnsignedType value)
+        {
+            for (std::size_t byte = 0; byte < sizeof(UnsignedType); ++byte) {
+                bytes.push_back(static_cast<std::uint8_t>(value >> (8 * byte)));
+            }
+        }
+
+        static std::uint64_t doubleBits(double value)
+        {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        }
+
+        static double bitsToDouble(std::uint64_t bits)
+        {
+            double value = 0.0;
+            std::memcpy(&value, &bits, sizeof(value));
+            return value;
+        }
+
+        static void mergeSortedInto(std::vector<double>& destination, const std::vector<double>& source)
+        {
+            const std::size_t middle = destination.size();
+            destination.insert(destination.end(), source.begin(), source.end());
+            std::inplace_merge(destination.begin(), destination.begin() + middle, destination.end());
+        }
+
+        void updateMinMax(double value)
+        {
+            if (count_ == 0 || value < minValue_) {
+                minValue_ = value;
+            }
+            if (count_ == 0 || value > maxValue_) {
+                maxValue_ = value;
+            }
+        }
+
+        /**
+         * Capacity shrinks by a factor of 2/3 per level below the top, which is
+         * what gives KLL its O(k) total size.
+         */
+        std::size_t levelCapacity(std::size_t level) const
+        {
+            const std::size_t depth = levels_.size() - 1 - level;
+            const double capacity = std::ceil(k_ * std::pow(2.0 / 3.0, static_cast<double>(depth)));
+            return std::max(minimumLevelCapacity, static_cast<std::size_t>(capacity));
+        }
+
+        std::size_t computeTotalCapacity() const
+        {
+            std::size_t total = 0;
+            for (std::size_t level = 0; level < levels_.size(); ++level) {
+                total += levelCapacity(level);
+            }
+            return total;
+        }
+
+        void compress()
+        {
+            while (retained_ > totalCapacity_) {
+                for (std::size_t level = 0; level < levels_.size(); ++level) {
+                    if (levels_[level].size() >= levelCapacity(level)) {
+                        compactLevel(level);
+                        break;
+                    }
+                }
+            }
+        }
+
+        /**
+         * Halves a level by promoting every other sorted item to the level above.
+         * With an odd item count, one item stays behind so total weight is preserved.
+         */
+        void compactLevel(std::size_t level)
+        {
+            if (level + 1 == levels_.size()) {
+                levels_.emplace_back();
+                totalCapacity_ = computeTotalCapacity();
+            }
+
+            std::vector<double>& items = levels_[level];
+            if (level == 0) {
+                std::sort(items.begin(), items.end());
+            }
+
+            std::vector<double> leftover;
+            if (items.size() % 2 == 1) {
+                leftover.push_back(items.back());
+                items.pop_back();
+            }
+
+            const std::size_t offset = detail::splitMix64(coinState_) & 1u;
+            std::vector<double> promoted;
+            promoted.reserve(items.size() / 2);
+            for (std::size_t i = offset; i < items.size(); i += 2) {
+                promoted.push_back(items[i]);
+            }
+
+            retained_ -= items.size() - promoted.size();
+            items.swap(leftover);
+            mergeSortedInto(levels_[level + 1], promoted);
+        }
+
+        std::vector<WeightedItem> buildSortedView() const
+        {
+            std::vector<WeightedItem> view;
+            view.reserve(retainedItems());
+            for (std::size_t level = 0; level < levels_.size(); ++level) {
+                const std::uint64_t weight = std::uint64_t{1} << level;
+                for (const double item : levels_[level]) {
+                    view.push_back({item, weight});
+                }
+            }
+
+            std::sort(view.begin(), view.end(),
+                      [](const WeightedItem& a, const WeightedItem& b) { return a.value < b.value; });
+
+            std::uint64_t cumulativeWeight = 0;
+            for (WeightedItem& item : view) {
+                cumulativeWeight += item.weight;
+                item.weight = cumulativeWeight;
+            }
+            return view;
+        }
+
+        double quantileFromView(const std::vector<WeightedItem>& sortedView, double fraction) const
+        {
+            if (fraction <= 0.0) {
+                return minValue_;
+            }
+            if (fraction >= 1.0) {
+                return maxValue_;
+            }
+
+            const double targetWeight = fraction * static_cast<double>(count_);
+            const auto match = std::find_if(sortedView.begin(), sortedView.end(),
+                                            [targetWeight](const WeightedItem& item) {
+                                                return static_cast<double>(item.weight) >= targetWeight;
+                                            });
+            if (match == sortedView.end()) {
+                return maxValue_;
+            }
+            return match->value;
+        }
+
+        std::uint16_t k_;
+        std::uint64_t coinState_;
+        std::uint64_t count_ = 0;
+        std::size_t retained_ = 0;
+        std::size_t totalCapacity_ = 0;
+        double minValue_ = 0.0;
+        double maxValue_ = 0.0;
+        std::vector<std::vector<double>> levels_;
+    };
+} // namespace stevensMathLib
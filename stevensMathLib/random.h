@@ -0,0 +1,487 @@
+/**
+ * stevensMathLib/random.h
+ *
+ * Thread-local random engine, seeding, and uniform scalar draws
+ * (randomFloat, randomInt, randomBool, randomBernoulli and bit masks).
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "instrumentation.h"
+
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <ctime>
+#include <random>
+#include <stdexcept>
+#include <vector>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Seeds the legacy random number generator
+     *
+     * @deprecated Use getRandomEngine() for modern C++ random number generation
+     *
+     * This function seeds the C-style rand() function with the current time.
+     * For new code, prefer using the modern C++ <random> library.
+     */
+    inline void seedRNG()
+    {
+        srand(static_cast<unsigned>(time(nullptr)));
+    }
+
+    /**
+     * @brief Returns a thread-local random number engine
+     *
+     * @return A reference to a mt19937 random engine, seeded with high-resolution clock
+     *
+     * This provides a modern, high-quality random number generator using
+     * the Mersenne Twister algorithm. The engine is thread-local to avoid
+     * race conditions in multithreaded code.
+     *
+     * Uses high-resolution clock for seeding to ensure each std::thread gets a unique
+     * seed while avoiding potential entropy exhaustion from repeated random_device usage.
+     */
+    inline std::mt19937& getRandomEngine()
+    {
+        thread_local std::mt19937 engine(
+            static_cast<unsigned int>(
+                std::chrono::high_resolution_clock::now().time_since_epoch().count()
+            )
+        );
+        return engine;
+    }
+
+    /**
+     * @brief Returns a thread-local 64-bit random engine
+     *
+     * @return A reference to a mt19937_64 random engine, seeded like getRandomEngine()
+     *
+     * Used by the generic integer functions in random_integral.h so that each
+     * 64-bit value costs one engine output instead of two stitched 32-bit ones.
+     * setSeed() seeds it together with getRandomEngine().
+     */
+    inline std::mt19937_64& getRandomEngine64()
+    {
+        thread_local std::mt19937_64 engine(
+            static_cast<std::uint64_t>(
+                std::chrono::high_resolution_clock::now().time_since_epoch().count()
+            )
+        );
+        return engine;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Unused bits of the last engine word drawn for randomBool()
+         */
+        struct RandomBitCache
+        {
+            std::uint32_t bits = 0;
+            int remaining = 0;
+        };
+
+        inline RandomBitCache& randomBitCache()
+        {
+            thread_local RandomBitCache cache;
+            return cache;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Re-seeds the random engine for reproducible generation (e.g. world seeds)
+     *
+     * Seeds both getRandomEngine() and getRandomEngine64(), and discards any
+     * bits randomBool() has cached from the old sequence.
+     */
+    inline void setSeed(unsigned int seed)
+    {
+        getRandomEngine().seed(seed);
+        getRandomEngine64().seed(seed);
+        detail::randomBitCache() = detail::RandomBitCache{};
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Unbiased integer in [0, range) from 32-bit engine outputs
+         *
+         * Lemire's "nearly divisionless" method: one multiply per draw, and the
+         * modulo needed for rejection is only computed in the rare case the
+         * low half of the product falls in the biased zone. Uses the low 32
+         * bits of each engine output.
+         */
+        template <typename Engine>
+        std::uint32_t boundedRandom(Engine& engine, std::uint32_t range)
+        {
+            std::uint64_t product = static_cast<std::uint64_t>(static_cast<std::uint32_t>(engine())) * range;
+            std::uint32_t lowBits = static_cast<std::uint32_t>(product);
+
+            if (lowBits < range) {
+                const std::uint32_t threshold = static_cast<std::uint32_t>(0u - range) % range;
+                while (lowBits < threshold) {
+                    product = static_cast<std::uint64_t>(static_cast<std::uint32_t>(engine())) * range;
+                    lowBits = static_cast<std::uint32_t>(product);
+                }
+            }
+            return static_cast<std::uint32_t>(product >> 32);
+        }
+
+        /**
+         * @brief Maps 24 random bits onto [lowerBound, upperBound] the way randomFloat() does
+         *
+         * u = bits / 2^24, evaluated in double and rounded once to float, so any
+         * source of the same bits yields the same float.
+         */
+        inline float floatFromBits(std::uint32_t bits, float lowerBound, float upperBound)
+        {
+            const double unit = static_cast<double>(bits) * (1.0 / 16777216.0);
+            const double span = static_cast<float>(upperBound - lowerBound);
+            return static_cast<float>(static_cast<double>(lowerBound) + span * unit);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Generates a random floating point number in a range
+     *
+     * @param lowerBound Inclusive lower bound (minimum value)
+     * @param upperBound Inclusive upper bound (maximum value)
+     * @return A random float between lowerBound and upperBound
+     *
+     * Takes the top 24 bits of one 32-bit engine output as u = k / 2^24 and
+     * returns lowerBound + (upperBound - lowerBound) * u, evaluated in double
+     * and rounded once to float. The product is exact in double, so the result
+     * is bit-identical across standard libraries and FMA contraction settings
+     * (unlike std::uniform_real_distribution, whose algorithm is unspecified).
+     */
+    inline float randomFloat(float lowerBound = 0.0f, float upperBound = 1.0f)
+    {
+        return detail::floatFromBits(static_cast<std::uint32_t>(getRandomEngine()()) >> 8,
+                                     lowerBound, upperBound);
+    }
+
+    /**
+     * @brief Generates a random integer in a range
+     *
+     * @param lowerBound Inclusive lower bound (minimum value)
+     * @param upperBound Exclusive upper bound (one past maximum value)
+     * @return A random integer in [lowerBound, upperBound)
+     *
+     * If upperBound <= lowerBound, returns lowerBound.
+     * Uses detail::boundedRandom (Lemire's method) on the raw engine output, so
+     * a given setSeed() yields the same sequence with every standard library.
+     */
+    inline int randomInt(int lowerBound = 0, int upperBound = 100)
+    {
+        if (upperBound <= lowerBound) {
+            return lowerBound;
+        }
+
+        const std::uint32_t range =
+            static_cast<std::uint32_t>(static_cast<std::int64_t>(upperBound) - lowerBound);
+        return static_cast<int>(static_cast<std::int64_t>(lowerBound) + detail::boundedRandom(getRandomEngine(), range));
+    }
+
+    /**
+     * @brief Fair coin flip using one bit of a cached engine word
+     *
+     * Replaces randomInt(0, 2): each 32-bit engine output serves 32 calls.
+     * The cache is per thread and cleared by setSeed().
+     */
+    inline bool randomBool()
+    {
+        detail::RandomBitCache& cache = detail::randomBitCache();
+        if (cache.remaining == 0) {
+            cache.bits = static_cast<std::uint32_t>(getRandomEngine()());
+            cache.remaining = 32;
+        }
+
+        const bool bit = (cache.bits & 1u) != 0;
+        cache.bits >>= 1;
+        --cache.remaining;
+        return bit;
+    }
+
+    namespace detail
+    {
+        inline int countTrailingZeros(std::uint32_t value)
+        {
+#if defined(__GNUC__)
+            return __builtin_ctz(value);
+#else
+            int count = 0;
+            while ((value & 1u) == 0) {
+                value >>= 1;
+                ++count;
+            }
+            return count;
+#endif
+        }
+
+        inline std::uint32_t reverseBits(std::uint32_t value)
+        {
+            value = ((value >> 1) & 0x55555555u) | ((value & 0x55555555u) << 1);
+            value = ((value >> 2) & 0x33333333u) | ((value & 0x33333333u) << 2);
+            value = ((value >> 4) & 0x0F0F0F0Fu) | ((value & 0x0F0F0F0Fu) << 4);
+            value = ((value >> 8) & 0x00FF00FFu) | ((value & 0x00FF00FFu) << 8);
+            return (value >> 16) | (value << 16);
+        }
+    } // namespace detail
+
+    /**
+     * @brief true with the given probability
+     *
+     * Compares a uniform U against p one binary digit at a time and stops at
+     * the first digit where they differ, so it consumes two cached random
+     * bits on average (the same bits randomBool() would return). Digits are
+     * compared 32 at a time with one XOR and a count of trailing zeros.
+     * Exact for any double p.
+     *
+     * @throws std::invalid_argument if probability is outside [0, 1]
+     */
+    inline bool randomBernoulli(double probability)
+    {
+        if (!(probability >= 0.0 && probability <= 1.0)) {
+            throw std::invalid_argument("stevensMathLib::randomBernoulli - probability must be in [0, 1]");
+        }
+        if (probability == 1.0) {
+            return true;
+        }
+
+        detail::RandomBitCache& cache = detail::randomBitCache();
+        double remaining = probability;
+
+        while (remaining > 0.0) {
+            // Next 32 binary digits of p, first digit in bit 0 to match the cache order
+            remaining *= 4294967296.0;
+            const std::uint32_t chunk = static_cast<std::uint32_t>(remaining);
+            remaining -= chunk;
+            std::uint64_t digits = detail::reverseBits(chunk);
+            // Past p's last 1 digit U >= p is already certain, so stop there
+            int digitsLeft = remaining > 0.0 ? 32 : 32 - detail::countTrailingZeros(chunk);
+
+            while (digitsLeft > 0) {
+                if (cache.remaining == 0) {
+                    cache.bits = static_cast<std::uint32_t>(getRandomEngine()());
+                    cache.remaining = 32;
+                }
+
+                const int compared = std::min(cache.remaining, digitsLeft);
+                const std::uint64_t window = (std::uint64_t{1} << compared) - 1;
+                const std::uint32_t difference = static_cast<std::uint32_t>((cache.bits ^ digits) & window);
+
+                // The first differing digit decides U < p; matching every
+                // remaining digit of p means U >= p. Either way the result is
+                // known, so both cases leave through one predictable branch.
+                const bool differs = difference != 0;
+                const std::uint32_t lastComparedBit = std::uint32_t{1} << (compared - 1);
+                const int consumed = detail::countTrailingZeros(difference | lastComparedBit) + 1;
+                const bool result = (((difference & digits) >> (consumed - 1)) & 1u) != 0;
+
+                cache.bits = static_cast<std::uint32_t>(static_cast<std::uint64_t>(cache.bits) >> consumed);
+                cache.remaining -= consumed;
+                digits >>= consumed;
+                digitsLeft -= consumed;
+
+                const bool finished = differs | ((digitsLeft == 0) & (remaining == 0.0));
+                if (finished) {
+                    return result;
+                }
+            }
+        }
+        // U has matched every digit of p, so U >= p
+        return false;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief SplitMix64 step, used to expand one seed into many lane states
+         * and as a cheap per-batch stream for stochastic rounding
+         */
+        inline std::uint64_t splitMix64(std::uint64_t& state)
+        {
+            std::uint64_t z = (state += 0x9E3779B97F4A7C15ull);
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            return z ^ (z >> 31);
+        }
+
+        inline std::uint64_t randomWord64()
+        {
+            std::mt19937& engine = getRandomEngine();
+            const std::uint64_t high = engine();
+            return (high << 32) | engine();
+        }
+
+        inline void clearUnusedMaskBits(std::uint64_t* masks, std::size_t trials)
+        {
+            const std::size_t usedBits = trials % 64;
+            if (usedBits != 0) {
+                masks[trials / 64] &= (std::uint64_t{1} << usedBits) - 1;
+            }
+        }
+    } // namespace detail
+
+    /**
+     * @brief Packs trials fair coin flips into 64-bit masks
+     *
+     * Bit i of masks[i / 64] is trial i. Writes (trials + 63) / 64 words;
+     * unused high bits of the last word are zero.
+     */
+    inline void randomBoolMask(std::uint64_t* masks, std::size_t trials)
+    {
+        const std::size_t words = (trials + 63) / 64;
+        for (std::size_t word = 0; word < words; ++word) {
+            masks[word] = detail::randomWord64();
+        }
+        detail::clearUnusedMaskBits(masks, trials);
+    }
+
+    /**
+     * @brief Packs trials Bernoulli(probability) outcomes into 64-bit masks
+     *
+     * Bit-sliced version of randomBernoulli(): 64 trials compare their
+     * uniforms against p together, one random word per binary digit, until
+     * every lane has been decided. Takes about 7 random words, i.e. about 14
+     * getRandomEngine() calls, per 64 trials for any p. Layout as randomBoolMask().
+     *
+     * @throws std::invalid_argument if probability is outside [0, 1]
+     */
+    inline void randomBernoulliMask(std::uint64_t* masks, std::size_t trials, double probability)
+    {
+        if (!(probability >= 0.0 && probability <= 1.0)) {
+            throw std::invalid_argument("stevensMathLib::randomBernoulliMask - probability must be in [0, 1]");
+        }
+
+        const std::size_t words = (trials + 63) / 64;
+        if (probability == 1.0) {
+            std::fill(masks, masks + words, ~std::uint64_t{0});
+            detail::clearUnusedMaskBits(masks, trials);
+            return;
+        }
+
+        for (std::size_t word = 0; word < words; ++word) {
+            std::uint64_t result = 0;
+            std::uint64_t undecided = ~std::uint64_t{0};
+            double remaining = probability;
+
+            while (undecided != 0 && remaining > 0.0) {
+                remaining *= 2.0;
+                const std::uint64_t uniformBits = detail::randomWord64();
+                if (remaining >= 1.0) {
+                    remaining -= 1.0;
+                    // Lanes whose uniform digit is 0 fall below p
+                    result |= undecided & ~uniformBits;
+                    undecided &= uniformBits;
+                } else {
+                    // Lanes whose uniform digit is 1 rise above p
+                    undecided &= ~uniformBits;
+                }
+            }
+            masks[word] = result;
+        }
+        detail::clearUnusedMaskBits(masks, trials);
+    }
+
+    /**
+     * @brief Generates a random integer not in a blacklist
+     *
+     * @param blacklist Vector of integers to exclude
+     * @param lowerBound Inclusive lower bound
+     * @param upperBound Exclusive upper bound
+     * @return A random integer in range that's not in the blacklist
+     *
+     * @throws std::invalid_argument if all integers in range are blacklisted
+     *
+     * This function uses a rejection sampling approach: it generates random
+     * integers until finding one not in the blacklist. This is efficient
+     * when the blacklist is small relative to the range.
+     */
+    inline int randomIntNotInBlacklist(const std::vector<int>& blacklist,
+                                       int lowerBound = 0,
+                                       int upperBound = 100)
+    {
+        detail::countEvent(InstrumentationCounter::BlacklistCalls);
+
+        const int rangeSize = upperBound - lowerBound;
+
+        if (rangeSize <= 0) {
+            throw std::invalid_argument(
+                "stevensMathLib::randomIntNotInBlacklist - upperBound must be greater than lowerBound");
+        }
+
+        if (static_cast<int>(blacklist.size()) >= rangeSize) {
+            throw std::invalid_argument(
+                "stevensMathLib::randomIntNotInBlacklist - blacklist size >= available range");
+        }
+
+        // Rejection sampling: keep generating until we find a non-blacklisted value
+        const int maxAttempts = rangeSize * 10;
+        for (int attempt = 0; attempt < maxAttempts; ++attempt) {
+            const int candidate = randomInt(lowerBound, upperBound);
+
+            const bool isBlacklisted = std::find(blacklist.begin(), blacklist.end(),
+                                                 candidate) != blacklist.end();
+            if (!isBlacklisted) {
+                detail::countEvent(InstrumentationCounter::BlacklistRejections,
+                                   static_cast<std::uint64_t>(attempt));
+                return candidate;
+            }
+        }
+
+        // Fallback: build valid set if rejection sampling fails
+        detail::countEvent(InstrumentationCounter::BlacklistRejections, static_cast<std::uint64_t>(maxAttempts));
+        detail::countEvent(InstrumentationCounter::BlacklistFallbacks);
+        std::vector<int> validNumbers;
+        validNumbers.reserve(rangeSize - blacklist.size());
+
+        for (int i = lowerBound; i < upperBound; ++i) {
+            const bool isBlacklisted = std::find(blacklist.begin(), blacklist.end(),
+                                                 i) != blacklist.end();
+            if (!isBlacklisted) {
+                validNumbers.push_back(i);
+            }
+        }
+
+        if (validNumbers.empty()) {
+            throw std::invalid_argument(
+                "stevensMathLib::randomIntNotInBlacklist - no valid integers remain after blacklist");
+        }
+
+        const int randomIndex = randomInt(0, static_cast<int>(validNumbers.size()));
+        return validNumbers[randomIndex];
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Uniform double in the open interval (0, 1) with 52 bits of resolution
+         *
+         * Built from two raw 32-bit engine outputs, so it never returns 0 or 1
+         * (safe to pass to std::log and std::log1p(-u)) and is identical on every
+         * standard library. The result is the odd multiple (2m + 1) * 2^-53 of a
+         * 52-bit m, which is exact in a double; a 53-bit m plus one half would
+         * round up to 1.0 for the largest m.
+         */
+        template <typename Engine>
+        double uniformOpenUnit(Engine& engine)
+        {
+            const std::uint64_t high = static_cast<std::uint32_t>(engine()) >> 6;  // 26 bits
+            const std::uint64_t low = static_cast<std::uint32_t>(engine()) >> 6;   // 26 bits
+            const std::uint64_t mantissa = (high << 26) | low;
+            return static_cast<double>((mantissa << 1) | 1) * (1.0 / 9007199254740992.0);
+        }
+    } // namespace detail
+} // namespace stevensMathLib
@@ -0,0 +1,393 @@
+/**
+ * stevensMathLib/random_id.h
+ *
+ * Random identifiers: UUIDv4 strings, base62 tokens and 64/128-bit ids.
+ *
+ * Every id is filled from whole 64-bit words rather than one randomInt() call
+ * per character, and the text forms are encoded without per-character
+ * branches straight into caller buffers.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <random>
+#include <string>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<sys/random.h>)
+#include <cerrno>
+#include <sys/random.h>
+#define STEVENSMATHLIB_HAS_GETRANDOM 1
+#endif
+#endif
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Where an id generator takes its random bits from
+     *
+     * Fast draws from getRandomEngine(): cheap, and reproducible after
+     * setSeed(), but a Mersenne Twister is predictable once an observer has
+     * seen enough of its output. Use it for ids that only need to be unique
+     * (request ids, database keys, test fixtures).
+     *
+     * Os reads every id straight from the operating system's CSPRNG
+     * (getrandom() on Linux, arc4random_buf() on the BSDs and macOS,
+     * std::random_device elsewhere). Nothing is buffered between calls, so a
+     * forked child never repeats its parent's ids. Use it for session tokens,
+     * API keys and anything else that must not be guessable.
+     */
+    enum class IdEntropy
+    {
+        Fast,
+        Os
+    };
+
+    /**
+     * @brief A 128-bit id; high holds the first eight bytes in big-endian order
+     */
+    struct Id128
+    {
+        std::uint64_t high = 0;
+        std::uint64_t low = 0;
+
+        friend bool operator==(const Id128& a, const Id128& b) { return a.high == b.high && a.low == b.low; }
+        friend bool operator!=(const Id128& a, const Id128& b) { return !(a == b); }
+        friend bool operator<(const Id128& a, const Id128& b)
+        {
+            return a.high < b.high || (a.high == b.high && a.low < b.low);
+        }
+    };
+
+    /**
+     * @brief Chars written per UUID: 32 hex digits and 4 hyphens, no terminator
+     */
+    inline constexpr std::size_t uuidLength = 36;
+
+    namespace detail
+    {
+        /**
+         * @brief Fills size bytes from the operating system's CSPRNG
+         */
+        inline void fillOsEntropy(unsigned char* out, std::size_t size)
+        {
+#if defined(STEVENSMATHLIB_HAS_GETRANDOM)
+            while (size > 0) {
+                const ssize_t read = getrandom(out, size, 0);
+                if (read < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    break; // ENOSYS on pre-3.17 kernels: use random_device below
+                }
+                out += read;
+                size -= static_cast<std::size_t>(read);
+            }
+            if (size == 0) {
+                return;
+            }
+#elif defined(__APPLE__) || defined(__FreeBSD__) || defined(__OpenBSD__) || defined(__NetBSD__)
+            arc4random_buf(out, size);
+            return;
+#endif
+            std::random_device device;
+            while (size > 0) {
+                const std::uint32_t word = device();
+                const std::size_t take = std::min(size, sizeof(word));
+                std::memcpy(out, &word, take);
+                out += take;
+                size -= take;
+            }
+        }
+
+        /**
+         * @brief Hands out 64-bit words for one id call, refilled in blocks
+         *
+         * Lives on the caller's stack for a single call, so Os words are never
+         * reused across calls (or across fork()). expectedWords sizes the
+         * first refills so a single id doesn't pay for a full block.
+         */
+        class IdWordSource
+        {
+        public:
+            IdWordSource(IdEntropy entropy, std::size_t expectedWords)
+                : entropy_(entropy), remainingHint_(expectedWords)
+            {
+            }
+
+            std::uint64_t next()
+            {
+                if (position_ == filled_) {
+                    refill();
+                }
+                return words_[position_++];
+            }
+
+        private:
+            static constexpr std::size_t capacity = 32;
+
+            void refill()
+            {
+                filled_ = std::min(capacity, std::max<std::size_t>(remainingHint_, 1));
+                remainingHint_ -= std::min(remainingHint_, filled_);
+                if (entropy_ == IdEntropy::Os) {
+                    fillOsEntropy(reinterpret_cast<unsigned char*>(words_), filled_ * sizeof(std::uint64_t));
+                } else {
+                    for (std::size_t i = 0; i < filled_; ++i) {
+                        words_[i] = randomWord64();
+                    }
+                }
+                position_ = 0;
+            }
+
+            IdEntropy entropy_;
+            std::size_t remainingHint_;
+            std::size_t position_ = 0;
+            std::size_t filled_ = 0;
+            std::uint64_t words_[capacity];
+        };
+
+        /**
+         * @brief Writes the eight lowercase hex digits of a 32-bit value
+         *
+         * SWAR: spreads the nibbles into the bytes of one word, then maps 0-9
+         * to '0'-'9' and 10-15 to 'a'-'f' in all eight bytes at once.
+         */
+        inline void writeHex32(std::uint32_t value, char* out)
+        {
+            std::uint64_t x = value;
+            x = (x | (x << 16)) & 0x0000FFFF0000FFFFull;
+            x = (x | (x << 8)) & 0x00FF00FF00FF00FFull;
+            x = (x | (x << 4)) & 0x0F0F0F0F0F0F0F0Full;
+            const std::uint64_t letters = ((x + 0x0606060606060606ull) >> 4) & 0x0101010101010101ull;
+            x += 0x3030303030303030ull + letters * ('a' - '0' - 10);
+            // Nibble k sits in byte k, and the most significant digit comes first
+            // (compiles to a byte swap and one store on little-endian targets)
+            for (int i = 0; i < 8; ++i) {
+                out[i] = static_cast<char>(x >> (8 * (7 - i)));
+            }
+        }
+
+        /**
+         * @brief Writes one UUIDv4 (version and variant bits set) as 36 chars
+         */
+        inline void encodeUuid(std::uint64_t high, std::uint64_t low, char* out)
+        {
+            high = (high & ~0xF000ull) | 0x4000ull;                          // version 4
+            low = (low & 0x3FFFFFFFFFFFFFFFull) | 0x8000000000000000ull;      // RFC 4122 variant
+
+            char hex[32];
+            writeHex32(static_cast<std::uint32_t>(high >> 32), hex);
+            writeHex32(static_cast<std::uint32_t>(high), hex + 8);
+            writeHex32(static_cast<std::uint32_t>(low >> 32), hex + 16);
+            writeHex32(static_cast<std::uint32_t>(low), hex + 24);
+
+            // 8-4-4-4-12
+            std::memcpy(out, hex, 8);
+            out[8] = '-';
+            std::memcpy(out + 9, hex + 8, 4);
+            out[13] = '-';
+            std::memcpy(out + 14, hex + 12, 4);
+            out[18] = '-';
+            std::memcpy(out + 19, hex + 16, 4);
+            out[23] = '-';
+            std::memcpy(out + 24, hex + 20, 12);
+        }
+
+        /**
+         * @brief Maps 0-61 to 0-9, A-Z, a-z without a lookup table or branch
+         *
+         * (9 - value) >> 31 is all ones past '9' and (35 - value) >> 31 past
+         * 'Z'; written as compares, GCC turns the digit case into a branch
+         * that mispredicts on one char in six.
+         */
+        inline char base62Digit(std::uint32_t value)
+        {
+            const std::uint32_t pastDigits = (9u - value) >> 31;
+            const std::uint32_t pastUpper = (35u - value) >> 31;
+            return static_cast<char>(value + '0' + pastDigits * ('A' - '9' - 1) + pastUpper * ('a' - 'Z' - 1));
+        }
+
+        /**
+         * @brief Writes length base62 chars, six random bits per candidate
+         *
+         * Candidates 62 and 63 are rejected so every char is exactly uniform.
+         * Rejection is branchless: each candidate is stored unconditionally and
+         * the write position only advances when it was accepted.
+         */
+        inline void encodeToken(char* out, std::size_t length, IdWordSource& source)
+        {
+            std::size_t written = 0;
+            // A whole word's 10 candidates fit: no bounds check per candidate
+            while (length - written >= 10) {
+                std::uint64_t word = source.next();
+                for (int chunk = 0; chunk < 10; ++chunk) {
+                    const std::uint32_t value = static_cast<std::uint32_t>(word & 63);
+                    word >>= 6;
+                    out[written] = base62Digit(value);
+                    written += value < 62;
+                }
+            }
+            while (written < length) {
+                std::uint64_t word = source.next();
+                for (int chunk = 0; chunk < 10 && written < length; ++chunk) {
+                    const std::uint32_t value = static_cast<std::uint32_t>(word & 63);
+                    word >>= 6;
+                    out[written] = base62Digit(value);
+                    written += value < 62;
+                }
+            }
+        }
+
+        // 10 six-bit candidates per word, 62/64 of them accepted
+        inline std::size_t expectedTokenWords(std::size_t chars)
+        {
+            return chars / 9 + 1;
+        }
+    } // namespace detail
+
+    /**
+     * @brief Writes a random version 4 UUID, e.g. "3f2b8c1e-9d4a-4f6b-a1c2-7e5d9b0a8f13"
+     *
+     * Costs two 64-bit draws and no per-char branches.
+     *
+     * @param out Destination for exactly uuidLength chars (not null-terminated)
+     * @param entropy Fast for unique-only ids, Os for unguessable ones
+     */
+    inline void randomUuid(char* out, IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, 2);
+        const std::uint64_t high = source.next();
+        detail::encodeUuid(high, source.next(), out);
+    }
+
+    /**
+     * @brief randomUuid() into a new std::string
+     */
+    inline std::string randomUuidString(IdEntropy entropy = IdEntropy::Fast)
+    {
+        std::string uuid(uuidLength, '\0');
+        randomUuid(&uuid[0], entropy);
+        return uuid;
+    }
+
+    /**
+     * @brief Writes count UUIDs back to back
+     *
+     * With IdEntropy::Os this makes one system call per 16 UUIDs instead of
+     * one per UUID.
+     *
+     * @param out Destination for count * uuidLength chars, no separators or terminators
+     * @param count Number of UUIDs
+     * @param entropy Fast for unique-only ids, Os for unguessable ones
+     */
+    inline void randomUuidBatch(char* out, std::size_t count, IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, 2 * count);
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::uint64_t high = source.next();
+            detail::encodeUuid(high, source.next(), out + i * uuidLength);
+        }
+    }
+
+    /**
+     * @brief Writes a random base62 token (0-9, A-Z, a-z)
+     *
+     * Each char carries log2(62) = 5.95 bits, so 22 chars give about 131
+     * bits, comparable to a UUID but URL-safe and shorter.
+     *
+     * @param out Destination for exactly length chars (not null-terminated)
+     * @param length Number of chars
+     * @param entropy Fast for unique-only ids, Os for unguessable ones
+     */
+    inline void randomToken(char* out, std::size_t length, IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, detail::expectedTokenWords(length));
+        detail::encodeToken(out, length, source);
+    }
+
+    /**
+     * @brief randomToken() into a new std::string
+     */
+    inline std::string randomTokenString(std::size_t length, IdEntropy entropy = IdEntropy::Fast)
+    {
+        std::string token(length, '\0');
+        if (length > 0) {
+            randomToken(&token[0], length, entropy);
+        }
+        return token;
+    }
+
+    /**
+     * @brief Writes count tokens of length chars back to back
+     *
+     * @param out Destination for count * length chars, no separators or terminators
+     * @param count Number of tokens
+     * @param length Chars per token
+     * @param entropy Fast for unique-only ids, Os for unguessable ones
+     */
+    inline void randomTokenBatch(char* out, std::size_t count, std::size_t length,
+                                 IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, detail::expectedTokenWords(count * length));
+        for (std::size_t i = 0; i < count; ++i) {
+            detail::encodeToken(out + i * length, length, source);
+        }
+    }
+
+    /**
+     * @brief Returns a uniformly random 64-bit id
+     */
+    inline std::uint64_t randomId64(IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, 1);
+        return source.next();
+    }
+
+    /**
+     * @brief Fills out with count uniformly random 64-bit ids
+     */
+    inline void randomId64Batch(std::uint64_t* out, std::size_t count, IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, count);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = source.next();
+        }
+    }
+
+    /**
+     * @brief Returns a uniformly random 128-bit id
+     */
+    inline Id128 randomId128(IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, 2);
+        Id128 id;
+        id.high = source.next();
+        id.low = source.next();
+        return id;
+    }
+
+    /**
+     * @brief Fills out with count uniformly random 128-bit ids
+     */
+    inline void randomId128Batch(Id128* out, std::size_t count, IdEntropy entropy = IdEntropy::Fast)
+    {
+        detail::IdWordSource source(entropy, 2 * count);
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i].high = source.next();
+            out[i].low = source.next();
+        }
+    }
+} // namespace stevensMathLib
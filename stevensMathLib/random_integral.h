@@ -0,0 +1,218 @@
+/**
+ * stevensMathLib/random_integral.h
+ *
+ * Bounded and full-range random values for every integer type, int8_t
+ * through uint64_t, at one 64-bit engine output per value.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <type_traits>
+
+namespace stevensMathLib
+{
+    namespace detail
+    {
+#if defined(__SIZEOF_INT128__)
+        __extension__ typedef unsigned __int128 UnsignedWideInt;
+#endif
+
+        /**
+         * @brief Full 128-bit product of two 64-bit values
+         *
+         * @return The high 64 bits; the low 64 bits are stored in low
+         */
+        inline std::uint64_t multiplyFull64(std::uint64_t a, std::uint64_t b, std::uint64_t& low)
+        {
+#if defined(__SIZEOF_INT128__)
+            const UnsignedWideInt product = static_cast<UnsignedWideInt>(a) * b;
+            low = static_cast<std::uint64_t>(product);
+            return static_cast<std::uint64_t>(product >> 64);
+#else
+            // Schoolbook multiply on 32-bit halves
+            const std::uint64_t aLow = a & 0xFFFFFFFFu;
+            const std::uint64_t aHigh = a >> 32;
+            const std::uint64_t bLow = b & 0xFFFFFFFFu;
+            const std::uint64_t bHigh = b >> 32;
+
+            const std::uint64_t lowLow = aLow * bLow;
+            const std::uint64_t highLow = aHigh * bLow;
+            const std::uint64_t lowHigh = aLow * bHigh;
+            const std::uint64_t highHigh = aHigh * bHigh;
+
+            const std::uint64_t middle = (lowLow >> 32) + (highLow & 0xFFFFFFFFu) + lowHigh;
+            low = (middle << 32) | (lowLow & 0xFFFFFFFFu);
+            return highHigh + (highLow >> 32) + (middle >> 32);
+#endif
+        }
+
+        /**
+         * @brief Unbiased integer in [0, range) from one 64-bit engine output
+         *
+         * The 64-bit form of boundedRandom(): the high half of output * range
+         * is the result, and the low half is only compared against the
+         * rejection threshold, which needs a division. Callers that draw
+         * many values from one range pass the threshold in precomputed.
+         */
+        template <typename Engine>
+        std::uint64_t boundedRandom64(Engine& engine, std::uint64_t range, std::uint64_t threshold)
+        {
+            std::uint64_t lowBits = 0;
+            std::uint64_t result = multiplyFull64(engine(), range, lowBits);
+            while (lowBits < threshold) {
+                result = multiplyFull64(engine(), range, lowBits);
+            }
+            return result;
+        }
+
+        template <typename Engine>
+        std::uint64_t boundedRandom64(Engine& engine, std::uint64_t range)
+        {
+            std::uint64_t lowBits = 0;
+            std::uint64_t result = multiplyFull64(engine(), range, lowBits);
+            if (lowBits < range) {
+                const std::uint64_t threshold = (0 - range) % range;
+                while (lowBits < threshold) {
+                    result = multiplyFull64(engine(), range, lowBits);
+                }
+            }
+            return result;
+        }
+
+        template <typename T>
+        constexpr void checkRandomIntegralType()
+        {
+            static_assert(std::is_integral<T>::value && !std::is_same<T, bool>::value,
+                          "stevensMathLib::randomIntegral requires a non-bool integer type");
+            static_assert(sizeof(T) <= sizeof(std::uint64_t),
+                          "stevensMathLib::randomIntegral supports integers up to 64 bits");
+        }
+
+        /**
+         * @brief Number of values in [lowerBound, upperBound], or 0 for all 2^64
+         */
+        template <typename T>
+        std::uint64_t inclusiveRange(T lowerBound, T upperBound)
+        {
+            using Unsigned = typename std::make_unsigned<T>::type;
+            const Unsigned span = static_cast<Unsigned>(static_cast<Unsigned>(upperBound) - static_cast<Unsigned>(lowerBound));
+            return static_cast<std::uint64_t>(span) + 1;
+        }
+
+        template <typename T>
+        T offsetFrom(T lowerBound, std::uint64_t offset)
+        {
+            using Unsigned = typename std::make_unsigned<T>::type;
+            return static_cast<T>(static_cast<Unsigned>(static_cast<Unsigned>(lowerBound) + static_cast<Unsigned>(offset)));
+        }
+    } // namespace detail
+
+    /**
+     * @brief Generates a random integer of any type in a closed range
+     *
+     * @tparam T Any integer type from int8_t to uint64_t (not bool)
+     * @param lowerBound Inclusive lower bound
+     * @param upperBound Inclusive upper bound
+     * @return A random T in [lowerBound, upperBound]
+     *
+     * Unlike randomInt(), the upper bound is inclusive so the full range of
+     * every type can be requested, e.g. randomIntegral<std::uint64_t>(0, UINT64_MAX).
+     * If upperBound < lowerBound, returns lowerBound.
+     *
+     * Costs one getRandomEngine64() output per value: Lemire's method with a
+     * 64x64 -> 128-bit multiply, no modulo bias and no stitched 32-bit draws.
+     */
+    template <typename T>
+    T randomIntegral(T lowerBound, T upperBound)
+    {
+        detail::checkRandomIntegralType<T>();
+        if (upperBound <= lowerBound) {
+            return lowerBound;
+        }
+
+        const std::uint64_t range = detail::inclusiveRange(lowerBound, upperBound);
+        std::mt19937_64& engine = getRandomEngine64();
+        const std::uint64_t offset = range == 0 ? engine() : detail::boundedRandom64(engine, range);
+        return detail::offsetFrom(lowerBound, offset);
+    }
+
+    /**
+     * @brief Uniformly random value over the whole range of T
+     *
+     * Equivalent to randomIntegral(min(), max()) without the multiply.
+     */
+    template <typename T>
+    T randomBits()
+    {
+        detail::checkRandomIntegralType<T>();
+        return static_cast<T>(getRandomEngine64()());
+    }
+
+    /**
+     * @brief Fills out with count random integers in [lowerBound, upperBound]
+     *
+     * Same values as count calls to randomIntegral(), but the rejection
+     * threshold (a 64-bit division) is computed once per batch.
+     */
+    template <typename T>
+    void randomIntegralBatch(T* out, std::size_t count, T lowerBound, T upperBound)
+    {
+        detail::checkRandomIntegralType<T>();
+        if (upperBound <= lowerBound) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = lowerBound;
+            }
+            return;
+        }
+
+        const std::uint64_t range = detail::inclusiveRange(lowerBound, upperBound);
+        std::mt19937_64& engine = getRandomEngine64();
+        if (range == 0) {
+            for (std::size_t i = 0; i < count; ++i) {
+                out[i] = detail::offsetFrom(lowerBound, engine());
+            }
+            return;
+        }
+
+        const std::uint64_t threshold = (0 - range) % range;
+        for (std::size_t i = 0; i < count; ++i) {
+            out[i] = detail::offsetFrom(lowerBound, detail::boundedRandom64(engine, range, threshold));
+        }
+    }
+
+    /**
+     * @brief Fills out with count uniformly random values of T
+     *
+     * Types narrower than 64 bits share engine outputs: eight int8_t values
+     * per output, four int16_t, two int32_t.
+     */
+    template <typename T>
+    void randomBitsBatch(T* out, std::size_t count)
+    {
+        detail::checkRandomIntegralType<T>();
+        std::mt19937_64& engine = getRandomEngine64();
+        constexpr std::size_t perWord = sizeof(std::uint64_t) / sizeof(T);
+
+        std::size_t i = 0;
+        for (; i + perWord <= count; i += perWord) {
+            const std::uint64_t word = engine();
+            std::memcpy(out + i, &word, sizeof(word));
+        }
+        if (i < count) {
+            const std::uint64_t word = engine();
+            std::memcpy(out + i, &word, (count - i) * sizeof(T));
+        }
+    }
+} // namespace stevensMathLib
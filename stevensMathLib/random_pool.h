@@ -0,0 +1,255 @@
+/**
+ * stevensMathLib/random_pool.h
+ *
+ * RandomPool: pre-generated random values with wait-free pops.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <thread>
+#include <vector>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Pre-generated pool of random 64-bit values with wait-free pops
+     *
+     * mt19937 regenerates its whole 624-word state every 624 draws, so one call
+     * in 624 to randomInt() is far slower than the rest. A RandomPool moves that
+     * work off the hot path: a single-producer/single-consumer ring buffer is
+     * filled in batches, either by a background thread (startBackgroundRefill())
+     * or by the owner during idle time (refill()). Pops never block; if the ring
+     * runs dry, next() falls back to the pool's own consumer-side engine, so a
+     * dry pool never advances getRandomEngine() behind the caller's back.
+     *
+     * Threading contract: one thread consumes (next(), tryPop(), nextInt(),
+     * nextFloat()). Exactly one producer refills: either the background thread
+     * or callers of refill(), never both at once.
+     *
+     * Both engines are seeded from one getRandomEngine() word at construction,
+     * so after setSeed() the pooled sequence is reproducible as long as no
+     * fallback draws occur (see fallbackCount()); which draws fall back depends
+     * on timing when a background thread refills.
+     *
+     * Satisfies UniformRandomBitGenerator, so it can drive <random> distributions.
+     */
+    class RandomPool
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        static constexpr std::size_t defaultCapacity = 4096;
+
+        /**
+         * @brief Creates an empty pool
+         *
+         * @param capacity Number of values the ring can hold (rounded up to a power of two)
+         */
+        explicit RandomPool(std::size_t capacity = defaultCapacity)
+            : slots_(roundUpToPowerOf2(std::max<std::size_t>(capacity, 2))),
+              mask_(slots_.size() - 1)
+        {
+            std::uint64_t seedState = detail::randomWord64();
+            producerEngine_.seed(detail::splitMix64(seedState));
+            fallbackEngine_.seed(detail::splitMix64(seedState));
+        }
+
+        RandomPool(const RandomPool&) = delete;
+        RandomPool& operator=(const RandomPool&) = delete;
+
+        ~RandomPool()
+        {
+            stopBackgroundRefill();
+        }
+
+        static constexpr result_type min() { return std::numeric_limits<result_type>::min(); }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()() { return next(); }
+
+        /**
+         * @brief Pops a pooled value, or generates one directly if the pool is empty
+         */
+        std::uint64_t next()
+        {
+            std::uint64_t value = 0;
+            if (tryPop(value)) {
+                return value;
+            }
+
+            ++fallbackCount_;
+            return fallbackEngine_();
+        }
+
+        /**
+         * @brief Pops a pooled value without ever generating one (wait-free)
+         *
+         * @param value Receives the popped value
+         * @return false if the pool was empty
+         */
+        bool tryPop(std::uint64_t& value)
+        {
+            const std::size_t head = head_.load(std::memory_order_relaxed);
+            if (head == cachedTail_) {
+                cachedTail_ = tail_.load(std::memory_order_acquire);
+                if (head == cachedTail_) {
+                    return false;
+                }
+            }
+
+            value = slots_[head & mask_];
+            head_.store(head + 1, std::memory_order_release);
+            return true;
+        }
+
+        /**
+         * @brief Random integer in [lowerBound, upperBound) drawn from the pool
+         *
+         * Same contract as randomInt(): returns lowerBound if upperBound <= lowerBound.
+         */
+        int nextInt(int lowerBound, int upperBound)
+        {
+            if (upperBound <= lowerBound) {
+                return lowerBound;
+            }
+
+            const std::uint32_t range =
+                static_cast<std::uint32_t>(static_cast<std::int64_t>(upperBound) - lowerBound);
+            return static_cast<int>(static_cast<std::int64_t>(lowerBound) + detail::boundedRandom(*this, range));
+        }
+
+        /**
+         * @brief Random float in [lowerBound, upperBound] drawn from the pool
+         *
+         * Maps the top 24 bits of one pooled value exactly as randomFloat() maps
+         * the top 24 bits of an engine output.
+         */
+        float nextFloat(float lowerBound = 0.0f, float upperBound = 1.0f)
+        {
+            return detail::floatFromBits(static_cast<std::uint32_t>(next() >> 40), lowerBound, upperBound);
+        }
+
+        /**
+         * @brief Generates values into every free slot (producer side)
+         *
+         * @return Number of values added
+         *
+         * Call during idle time when no background refill thread is running.
+         */
+        std::size_t refill()
+        {
+            static constexpr std::size_t publishBatch = 64;
+
+            std::size_t tail = tail_.load(std::memory_order_relaxed);
+            const std::size_t head = head_.load(std::memory_order_acquire);
+            const std::size_t freeSlots = slots_.size() - (tail - head);
+
+            for (std::size_t produced = 0; produced < freeSlots; ) {
+                const std::size_t batch = std::min(publishBatch, freeSlots - produced);
+                for (std::size_t i = 0; i < batch; ++i) {
+                    slots_[(tail + i) & mask_] = producerEngine_();
+                }
+                tail += batch;
+                produced += batch;
+                tail_.store(tail, std::memory_order_release);
+            }
+            return freeSlots;
+        }
+
+        /**
+         * @brief Starts a thread that keeps the pool topped up
+         *
+         * @param idleSleep How long the thread sleeps between checks while the pool is nearly full
+         *
+         * The thread refills only once at least an eighth of the ring is free,
+         * so a consumer taking a few values at a time does not keep it spinning
+         * on a core. Does nothing if the thread is already running.
+         */
+        void startBackgroundRefill(std::chrono::microseconds idleSleep = std::chrono::microseconds(50))
+        {
+            if (refillThread_.joinable()) {
+                return;
+            }
+
+            refillRunning_.store(true, std::memory_order_relaxed);
+            refillThread_ = std::thread([this, idleSleep] {
+                const std::size_t lowWatermark = slots_.size() / 8;
+                while (refillRunning_.load(std::memory_order_relaxed)) {
+                    if (slots_.size() - available() >= std::max<std::size_t>(lowWatermark, 1)) {
+                        refill();
+                    } else {
+                        std::this_thread::sleep_for(idleSleep);
+                    }
+                }
+            });
+        }
+
+        /**
+         * @brief Stops and joins the background refill thread, if any
+         */
+        void stopBackgroundRefill()
+        {
+            if (!refillThread_.joinable()) {
+                return;
+            }
+
+            refillRunning_.store(false, std::memory_order_relaxed);
+            refillThread_.join();
+        }
+
+        /**
+         * @brief Number of values currently pooled (approximate while a producer runs)
+         */
+        std::size_t available() const
+        {
+            return tail_.load(std::memory_order_acquire) - head_.load(std::memory_order_acquire);
+        }
+
+        std::size_t capacity() const { return slots_.size(); }
+
+        /**
+         * @brief Number of next() calls that found the pool empty (consumer thread only)
+         */
+        std::uint64_t fallbackCount() const { return fallbackCount_; }
+
+    private:
+        static constexpr std::size_t cacheLineSize = 64;
+
+        static std::size_t roundUpToPowerOf2(std::size_t value)
+        {
+            std::size_t power = 1;
+            while (power < value) {
+                power <<= 1;
+            }
+            return power;
+        }
+
+        std::vector<std::uint64_t> slots_;
+        std::size_t mask_;
+        std::mt19937_64 producerEngine_;
+        std::mt19937_64 fallbackEngine_; // Consumer thread only
+
+        // Producer and consumer indices live on separate cache lines to avoid false sharing
+        alignas(cacheLineSize) std::atomic<std::size_t> head_{0};
+        std::size_t cachedTail_ = 0;
+        std::uint64_t fallbackCount_ = 0;
+        alignas(cacheLineSize) std::atomic<std::size_t> tail_{0};
+
+        std::atomic<bool> refillRunning_{false};
+        std::thread refillThread_;
+    };
+} // namespace stevensMathLib
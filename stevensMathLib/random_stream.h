@@ -0,0 +1,514 @@
+/**
+ * stevensMathLib/random_stream.h
+ *
+ * Lazy random streams that fuse rounding, range filtering and conversion.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "conversion.h"
+#include "random.h"
+#include "range.h"
+#include "rounding.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <random>
+#if __cplusplus >= 202002L
+#include <ranges>
+#endif
+#include <type_traits>
+#include <utility>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Random streams: lazy, infinite sequences that fuse with transforms
+     *
+     * A stream such as randomFloats(0.0f, 10.0f) | rounded(1) | keepInRange(2.0f, 8.0f) | asInt()
+     * replaces "fill a vector, then round, then filter, then convert", which
+     * allocates a temporary per step. Nothing is evaluated until values are
+     * pulled with fill(), next(), take() or iteration; then the whole chain
+     * runs in blocks of blockSize values on stack buffers, one stage at a
+     * time, so each stage is a tight loop the compiler can vectorize. No
+     * stage allocates.
+     *
+     * Works with range-for in C++17 and models std::ranges::input_range in
+     * C++20. Streams are infinite; a filter that rejects every value never
+     * returns.
+     */
+    namespace detail
+    {
+        constexpr std::size_t streamBlockSize = 256;
+
+        /**
+         * @brief Stream source with the same mapping as randomFloat()
+         */
+        template <typename Engine>
+        class RandomFloatSource
+        {
+        public:
+            using value_type = float;
+
+            RandomFloatSource(float lowerBound, float upperBound, Engine& engine)
+                : lower_(lowerBound),
+                  span_(static_cast<float>(upperBound - lowerBound)),
+                  engine_(&engine)
+            {
+            }
+
+            std::size_t produce(float* out, std::size_t count)
+            {
+                std::uint32_t bits[streamBlockSize];
+                count = std::min(count, streamBlockSize);
+
+                Engine& engine = *engine_;
+                for (std::size_t i = 0; i < count; ++i) {
+                    bits[i] = static_cast<std::uint32_t>(engine()) >> 8;
+                }
+                for (std::size_t i = 0; i < count; ++i) {
+                    const double unit = static_cast<double>(bits[i]) * (1.0 / 16777216.0);
+                    out[i] = static_cast<float>(lower_ + span_ * unit);
+                }
+                return count;
+            }
+
+        private:
+            double lower_;
+            double span_;
+            Engine* engine_;
+        };
+
+        /**
+         * @brief Stream source with the same mapping as randomInt()
+         */
+        template <typename Engine>
+        class RandomIntSource
+        {
+        public:
+            using value_type = int;
+
+            RandomIntSource(int lowerBound, int upperBound, Engine& engine)
+                : lower_(lowerBound),
+                  range_(upperBound <= lowerBound
+                             ? 0u
+                             : static_cast<std::uint32_t>(static_cast<std::int64_t>(upperBound) - lowerBound)),
+                  engine_(&engine)
+            {
+            }
+
+            std::size_t produce(int* out, std::size_t count)
+            {
+                count = std::min(count, streamBlockSize);
+
+                for (std::size_t i = 0; i < count; ++i) {
+                    out[i] = range_ == 0
+                                 ? lower_
+                                 : static_cast<int>(static_cast<std::int64_t>(lower_) +
+                                                    boundedRandom(*engine_, range_));
+                }
+                return count;
+            }
+
+        private:
+            int lower_;
+            std::uint32_t range_;
+            Engine* engine_;
+        };
+
+        /**
+         * @brief Applies a function to every value of the upstream node
+         */
+        template <typename Upstream, typename Function>
+        class MapNode
+        {
+        public:
+            using input_type = typename Upstream::value_type;
+            using value_type = std::decay_t<std::invoke_result_t<const Function&, input_type>>;
+
+            MapNode(Upstream upstream, Function function)
+                : upstream_(std::move(upstream)), function_(std::move(function))
+            {
+            }
+
+            std::size_t produce(value_type* out, std::size_t count)
+            {
+                count = std::min(count, streamBlockSize);
+
+                if constexpr (std::is_same_v<input_type, value_type>) {
+                    // Same type: transform in place, no extra buffer
+                    const std::size_t produced = upstream_.produce(out, count);
+                    for (std::size_t i = 0; i < produced; ++i) {
+                        out[i] = function_(out[i]);
+                    }
+                    return produced;
+                } else {
+                    input_type buffer[streamBlockSize];
+                    const std::size_t produced = upstream_.produce(buffer, count);
+                    for (std::size_t i = 0; i < produced; ++i) {
+                        out[i] = function_(buffer[i]);
+                    }
+                    return produced;
+                }
+            }
+
+        private:
+            Upstream upstream_;
+            Function function_;
+        };
+
+        /**
+         * @brief Keeps only the upstream values that satisfy a predicate
+         *
+         * May return fewer values than requested (including none).
+         */
+        template <typename Upstream, typename Predicate>
+        class FilterNode
+        {
+        public:
+            using value_type = typename Upstream::value_type;
+
+            FilterNode(Upstream upstream, Predicate predicate)
+                : upstream_(std::move(upstream)), predicate_(std::move(predicate))
+            {
+            }
+
+            std::size_t produce(value_type* out, std::size_t count)
+            {
+                const std::size_t produced = upstream_.produce(out, count);
+                std::size_t kept = 0;
+                for (std::size_t i = 0; i < produced; ++i) {
+                    out[kept] = out[i];
+                    kept += predicate_(out[i]) ? 1 : 0;
+                }
+                return kept;
+            }
+
+        private:
+            Upstream upstream_;
+            Predicate predicate_;
+        };
+
+        /**
+         * @brief round(value, decimalPlaces) with the scale factor hoisted out of the loop
+         */
+        struct RoundFunction
+        {
+            float scaleFactor;
+
+            float operator()(float value) const
+            {
+                return std::round(value * scaleFactor) / scaleFactor;
+            }
+        };
+
+        template <typename T>
+        struct InRangePredicate
+        {
+            T lowerBound;
+            T upperBound;
+            BoundType boundType;
+
+            bool operator()(const T& value) const
+            {
+                return in_range(value, lowerBound, upperBound, boundType);
+            }
+        };
+
+        struct FloatToIntFunction
+        {
+            template <typename FloatType>
+            int operator()(const FloatType& value) const
+            {
+                return floatToInt(value);
+            }
+        };
+
+        // Pipe-able stage descriptions; operator| turns them into nodes
+        template <typename Function>
+        struct MapStage
+        {
+            Function function;
+        };
+
+        template <typename Predicate>
+        struct FilterStage
+        {
+            Predicate predicate;
+        };
+    } // namespace detail
+
+    /**
+     * @brief An infinite lazy stream of values produced by a pipeline of nodes
+     *
+     * Obtain one from randomFloats() or randomInts() and extend it with
+     * operator| and rounded(), keepInRange(), asInt() or mapValues().
+     */
+    template <typename Node>
+    class RandomStream
+#if __cplusplus >= 202002L
+        : public std::ranges::view_base
+#endif
+    {
+    public:
+        using value_type = typename Node::value_type;
+
+        static constexpr std::size_t blockSize = detail::streamBlockSize;
+
+        /**
+         * @brief Never reached: streams are infinite
+         */
+        struct Sentinel
+        {
+        };
+
+        class Iterator
+        {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = typename RandomStream::value_type;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const value_type*;
+            using reference = const value_type&;
+
+            Iterator() = default;
+
+            explicit Iterator(RandomStream* stream)
+                : stream_(stream)
+            {
+                stream_->ensureBuffered();
+            }
+
+            reference operator*() const { return stream_->buffer_[stream_->position_]; }
+
+            Iterator& operator++()
+            {
+                ++stream_->position_;
+                stream_->ensureBuffered();
+                return *this;
+            }
+
+            void operator++(int) { ++*this; }
+
+            friend bool operator==(const Iterator&, Sentinel) { return false; }
+            friend bool operator!=(const Iterator&, Sentinel) { return true; }
+            friend bool operator==(Sentinel, const Iterator&) { return false; }
+            friend bool operator!=(Sentinel, const Iterator&) { return true; }
+
+        private:
+            RandomStream* stream_ = nullptr;
+        };
+
+        /**
+         * @brief The first count values of a stream, for range-for loops
+         */
+        class Taken
+        {
+        public:
+            class TakenIterator
+            {
+            public:
+                using iterator_category = std::input_iterator_tag;
+                using value_type = typename RandomStream::value_type;
+                using difference_type = std::ptrdiff_t;
+                using pointer = const value_type*;
+                using reference = const value_type&;
+
+                TakenIterator(RandomStream* stream, std::size_t remaining)
+                    : stream_(stream), remaining_(remaining)
+                {
+                    if (remaining_ > 0) {
+                        stream_->ensureBuffered();
+                    }
+                }
+
+                reference operator*() const { return stream_->buffer_[stream_->position_]; }
+
+                TakenIterator& operator++()
+                {
+                    // Consume the value, but do not generate past the last requested one
+                    ++stream_->position_;
+                    if (--remaining_ > 0) {
+                        stream_->ensureBuffered();
+                    }
+                    return *this;
+                }
+
+                void operator++(int) { ++*this; }
+
+                bool operator==(const TakenIterator& other) const { return remaining_ == other.remaining_; }
+                bool operator!=(const TakenIterator& other) const { return remaining_ != other.remaining_; }
+
+            private:
+                RandomStream* stream_;
+                std::size_t remaining_;
+            };
+
+            Taken(RandomStream* stream, std::size_t count)
+                : stream_(stream), count_(count)
+            {
+            }
+
+            TakenIterator begin() const { return TakenIterator(stream_, count_); }
+            TakenIterator end() const { return TakenIterator(stream_, 0); }
+
+        private:
+            RandomStream* stream_;
+            std::size_t count_;
+        };
+
+        explicit RandomStream(Node node)
+            : node_(std::move(node))
+        {
+        }
+
+        /**
+         * @brief Writes exactly count values to out
+         *
+         * Values already buffered by iteration or next() come first.
+         */
+        void fill(value_type* out, std::size_t count)
+        {
+            while (count > 0 && position_ < available_) {
+                *out++ = buffer_[position_++];
+                --count;
+            }
+            while (count > 0) {
+                const std::size_t produced = node_.produce(out, std::min(count, blockSize));
+                out += produced;
+                count -= produced;
+            }
+        }
+
+        /**
+         * @brief The next single value
+         */
+        value_type next()
+        {
+            ensureBuffered();
+            return buffer_[position_++];
+        }
+
+        /**
+         * @brief A range over the next count values
+         *
+         * The range reads from this stream, which must outlive it.
+         */
+        Taken take(std::size_t count) { return Taken(this, count); }
+
+        Iterator begin() { return Iterator(this); }
+        Sentinel end() const { return Sentinel{}; }
+
+        /**
+         * @brief Releases the pipeline so operator| can extend it
+         */
+        Node releaseNode() && { return std::move(node_); }
+
+    private:
+        void ensureBuffered()
+        {
+            while (position_ >= available_) {
+                available_ = node_.produce(buffer_, blockSize);
+                position_ = 0;
+            }
+        }
+
+        Node node_;
+        value_type buffer_[blockSize] = {};
+        std::size_t position_ = 0;
+        std::size_t available_ = 0;
+    };
+
+    /**
+     * @brief Infinite stream of randomFloat(lowerBound, upperBound) values
+     *
+     * Draws from getRandomEngine(), so it continues the same sequence that
+     * repeated randomFloat() calls would produce.
+     */
+    inline RandomStream<detail::RandomFloatSource<std::mt19937>> randomFloats(float lowerBound = 0.0f,
+                                                                             float upperBound = 1.0f)
+    {
+        return RandomStream<detail::RandomFloatSource<std::mt19937>>(
+            detail::RandomFloatSource<std::mt19937>(lowerBound, upperBound, getRandomEngine()));
+    }
+
+    /**
+     * @brief Infinite stream of random floats drawn from the given engine
+     *
+     * The engine must outlive the stream.
+     */
+    template <typename Engine>
+    RandomStream<detail::RandomFloatSource<Engine>> randomFloats(float lowerBound, float upperBound, Engine& engine)
+    {
+        return RandomStream<detail::RandomFloatSource<Engine>>(
+            detail::RandomFloatSource<Engine>(lowerBound, upperBound, engine));
+    }
+
+    /**
+     * @brief Infinite stream of randomInt(lowerBound, upperBound) values
+     */
+    inline RandomStream<detail::RandomIntSource<std::mt19937>> randomInts(int lowerBound = 0, int upperBound = 100)
+    {
+        return RandomStream<detail::RandomIntSource<std::mt19937>>(
+            detail::RandomIntSource<std::mt19937>(lowerBound, upperBound, getRandomEngine()));
+    }
+
+    /**
+     * @brief Stream stage: round(value, decimalPlaces)
+     */
+    inline detail::MapStage<detail::RoundFunction> rounded(int decimalPlaces)
+    {
+        decimalPlaces = detail::absolutePrecision(decimalPlaces, "rounded()");
+        return {detail::RoundFunction{static_cast<float>(std::pow(10.0f, decimalPlaces))}};
+    }
+
+    /**
+     * @brief Stream stage: keeps values for which in_range() is true
+     */
+    template <typename T>
+    detail::FilterStage<detail::InRangePredicate<T>> keepInRange(T lowerBound, T upperBound,
+                                                                  BoundType boundType = BoundType::Inclusive)
+    {
+        return {detail::InRangePredicate<T>{lowerBound, upperBound, boundType}};
+    }
+
+    /**
+     * @brief Stream stage: floatToInt(value)
+     */
+    inline detail::MapStage<detail::FloatToIntFunction> asInt()
+    {
+        return {detail::FloatToIntFunction{}};
+    }
+
+    /**
+     * @brief Stream stage: applies any function to each value
+     */
+    template <typename Function>
+    detail::MapStage<Function> mapValues(Function function)
+    {
+        return {std::move(function)};
+    }
+
+    template <typename Node, typename Function>
+    RandomStream<detail::MapNode<Node, Function>> operator|(RandomStream<Node> stream, detail::MapStage<Function> stage)
+    {
+        return RandomStream<detail::MapNode<Node, Function>>(
+            detail::MapNode<Node, Function>(std::move(stream).releaseNode(), std::move(stage.function)));
+    }
+
+    template <typename Node, typename Predicate>
+    RandomStream<detail::FilterNode<Node, Predicate>> operator|(RandomStream<Node> stream,
+                                                                detail::FilterStage<Predicate> stage)
+    {
+        return RandomStream<detail::FilterNode<Node, Predicate>>(
+            detail::FilterNode<Node, Predicate>(std::move(stream).releaseNode(), std::move(stage.predicate)));
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,917 @@
+/**
+ * stevensMathLib/random_tables.h
+ *
+ * Precomputed random tables in a versioned binary file, built once from a
+ * seed and memory-mapped read-only by every process that needs them.
+ *
+ * A world seed expands into pregenerated random words, shuffled permutation
+ * tables (e.g. for gradient noise) and alias tables for fixed distributions.
+ * RandomTableBuilder writes them once; each worker then opens the file with
+ * RandomTables, which maps it with MAP_SHARED so all processes share one copy
+ * of the pages in the page cache instead of each regenerating its own.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+#include "random_integral.h"
+#include "sampling.h"
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <limits>
+#include <memory>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define STEVENSMATHLIB_HAS_MMAP 1
+#endif
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Version of the file layout (header, directory, alignment)
+     */
+    inline constexpr std::uint32_t randomTableFormatVersion = 1;
+
+    /**
+     * @brief Version of the algorithms that turn a seed into table contents
+     *
+     * Bumped whenever a table built from the same seed would come out
+     * different, so a worker never reads tables generated by another release.
+     */
+    inline constexpr std::uint32_t randomTableAlgorithmVersion = 1;
+
+    /**
+     * @brief Longest table name, in chars
+     */
+    inline constexpr std::size_t randomTableMaxNameLength = 23;
+
+    enum class RandomTableKind : std::uint32_t
+    {
+        Words = 1,       // uint64_t random words
+        Permutation = 2, // shuffled uint32_t values 0..size-1
+        Alias = 3        // AliasTable columns: uint64_t thresholds, then uint32_t aliases
+    };
+
+    /**
+     * @brief How RandomTables brings the file into memory
+     *
+     * Map shares the file's pages between processes and falls back to Read
+     * if the platform or filesystem cannot map it. Read copies the whole file
+     * into a private buffer.
+     */
+    enum class TableLoading
+    {
+        Map,
+        Read
+    };
+
+    namespace detail
+    {
+        struct RandomTableHeader
+        {
+            char magic[8];
+            std::uint32_t formatVersion;
+            std::uint32_t byteOrderMark;
+            std::uint64_t seed;
+            std::uint32_t algorithmVersion;
+            std::uint32_t tableCount;
+            std::uint64_t fileSize;
+            std::uint64_t payloadChecksum;
+            std::uint64_t directoryChecksum; // Header with this field zeroed, then the directory
+            std::uint64_t reserved;
+        };
+
+        struct RandomTableEntry
+        {
+            char name[randomTableMaxNameLength + 1];
+            std::uint32_t kind;
+            std::uint32_t reserved;
+            std::uint64_t offset; // From the start of the file, a multiple of randomTableAlignment
+            std::uint64_t count;  // Elements, or columns for an alias table
+        };
+
+        static_assert(sizeof(RandomTableHeader) == 64, "RandomTableHeader must stay 64 bytes");
+        static_assert(sizeof(RandomTableEntry) == 48, "RandomTableEntry must stay 48 bytes");
+        static_assert(std::is_trivially_copyable<RandomTableHeader>::value, "RandomTableHeader is copied with memcpy");
+        static_assert(std::is_trivially_copyable<RandomTableEntry>::value, "RandomTableEntry is copied with memcpy");
+
+        inline constexpr char randomTableMagic[8] = {'S', 'M', 'L', 'T', 'A', 'B', 'L', 'E'};
+        inline constexpr std::uint32_t randomTableByteOrderMark = 0x01020304u;
+
+        // Every table starts on a cache line
+        inline constexpr std::uint64_t randomTableAlignment = 64;
+
+        inline std::uint64_t alignTableOffset(std::uint64_t offset)
+        {
+            return (offset + randomTableAlignment - 1) & ~(randomTableAlignment - 1);
+        }
+
+        inline std::uint64_t tableDataStart(std::uint64_t tableCount)
+        {
+            return alignTableOffset(sizeof(RandomTableHeader) + tableCount * sizeof(RandomTableEntry));
+        }
+
+        /**
+         * @brief Bytes a table occupies before alignment padding
+         */
+        inline std::uint64_t tableBytes(RandomTableKind kind, std::uint64_t count)
+        {
+            switch (kind) {
+            case RandomTableKind::Words:
+                return count * sizeof(std::uint64_t);
+            case RandomTableKind::Permutation:
+                return count * sizeof(std::uint32_t);
+            case RandomTableKind::Alias:
+                return count * (sizeof(std::uint64_t) + sizeof(std::uint32_t));
+            }
+            return 0;
+        }
+
+        inline constexpr std::uint64_t tableChecksumBasis = 0xCBF29CE484222325ull;
+
+        /**
+         * @brief FNV-1a over 64-bit words; size must be a multiple of 8
+         *
+         * Catches truncated or corrupted files, not tampering.
+         */
+        inline std::uint64_t tableChecksum(std::uint64_t checksum, const void* data, std::size_t size)
+        {
+            const unsigned char* bytes = static_cast<const unsigned char*>(data);
+            for (std::size_t i = 0; i + sizeof(std::uint64_t) <= size; i += sizeof(std::uint64_t)) {
+                std::uint64_t word = 0;
+                std::memcpy(&word, bytes + i, sizeof(word));
+                checksum = (checksum ^ word) * 0x100000001B3ull;
+            }
+            return checksum;
+        }
+
+        inline std::uint64_t directoryChecksum(RandomTableHeader header, const void* directory, std::size_t size)
+        {
+            header.directoryChecksum = 0;
+            return tableChecksum(tableChecksum(tableChecksumBasis, &header, sizeof(header)), directory, size);
+        }
+
+        /**
+         * @brief Engine that generates one table's contents
+         *
+         * Seeded from the world seed and the table name, so a table comes out
+         * the same no matter which other tables share its file.
+         */
+        inline std::mt19937_64 tableEngine(std::uint64_t seed, const std::string& name)
+        {
+            std::uint64_t nameHash = tableChecksumBasis;
+            for (const char c : name) {
+                nameHash = (nameHash ^ static_cast<unsigned char>(c)) * 0x100000001B3ull;
+            }
+            std::uint64_t state = seed ^ nameHash;
+            return std::mt19937_64(splitMix64(state));
+        }
+
+        /**
+         * @brief Sequential file writer that checksums everything after the directory
+         */
+        class RandomTableWriter
+        {
+        public:
+            explicit RandomTableWriter(std::FILE* file)
+                : file_(file)
+            {
+            }
+
+            bool write(const void* data, std::size_t size)
+            {
+                checksum_ = tableChecksum(checksum_, data, size);
+                position_ += size;
+                return std::fwrite(data, 1, size, file_) == size;
+            }
+
+            bool padTo(std::uint64_t offset)
+            {
+                static const unsigned char zeros[randomTableAlignment] = {};
+                return write(zeros, static_cast<std::size_t>(offset - position_));
+            }
+
+            void startPayload(std::uint64_t position)
+            {
+                position_ = position;
+                checksum_ = tableChecksumBasis;
+            }
+
+            std::uint64_t position() const { return position_; }
+            std::uint64_t checksum() const { return checksum_; }
+
+        private:
+            std::FILE* file_;
+            std::uint64_t position_ = 0;
+            std::uint64_t checksum_ = tableChecksumBasis;
+        };
+    } // namespace detail
+
+    /**
+     * @brief Engine over a table of pregenerated random words
+     *
+     * Satisfies UniformRandomBitGenerator, so it can drive AliasTable::sample(),
+     * the distribution samplers, RandomPermutation and the std distributions
+     * in place of a live engine. Each call is one load; the sequence wraps
+     * around at the end of the table, so size the table for the number of
+     * draws a worker makes, and give workers different start offsets.
+     */
+    class TableEngine
+    {
+    public:
+        using result_type = std::uint64_t;
+
+        /**
+         * @throws std::invalid_argument if size is 0
+         */
+        TableEngine(const std::uint64_t* words, std::size_t size, std::size_t start = 0)
+            : words_(words), size_(size), position_(size == 0 ? 0 : start % size)
+        {
+            if (size == 0) {
+                throw std::invalid_argument("stevensMathLib::TableEngine - table must not be empty");
+            }
+        }
+
+        static constexpr result_type min() { return 0; }
+        static constexpr result_type max() { return std::numeric_limits<result_type>::max(); }
+
+        result_type operator()()
+        {
+            const result_type value = words_[position_];
+            if (++position_ == size_) {
+                position_ = 0;
+            }
+            return value;
+        }
+
+        /**
+         * @brief Index of the word the next call returns
+         */
+        std::size_t position() const { return position_; }
+
+    private:
+        const std::uint64_t* words_;
+        std::size_t size_;
+        std::size_t position_;
+    };
+
+    /**
+     * @brief Read-only view of a table of random words
+     */
+    class RandomWordsView
+    {
+    public:
+        RandomWordsView(const std::uint64_t* words, std::size_t size)
+            : words_(words), size_(size)
+        {
+        }
+
+        std::uint64_t operator[](std::size_t index) const { return words_[index]; }
+        const std::uint64_t* data() const { return words_; }
+        std::size_t size() const { return size_; }
+        const std::uint64_t* begin() const { return words_; }
+        const std::uint64_t* end() const { return words_ + size_; }
+
+        /**
+         * @brief An engine that reads this table from word start onward
+         */
+        TableEngine engine(std::size_t start = 0) const { return TableEngine(words_, size_, start); }
+
+    private:
+        const std::uint64_t* words_;
+        std::size_t size_;
+    };
+
+    /**
+     * @brief Read-only view of a shuffled permutation of 0..size-1
+     *
+     * The classic gradient-noise lookup, e.g.
+     * permutation[(x + permutation[y & mask]) & mask] for a power-of-2 size.
+     */
+    class PermutationTableView
+    {
+    public:
+        PermutationTableView(const std::uint32_t* values, std::size_t size)
+            : values_(values), size_(size)
+        {
+        }
+
+        std::uint32_t operator[](std::size_t index) const { return values_[index]; }
+        const std::uint32_t* data() const { return values_; }
+        std::size_t size() const { return size_; }
+        const std::uint32_t* begin() const { return values_; }
+        const std::uint32_t* end() const { return values_ + size_; }
+
+    private:
+        const std::uint32_t* values_;
+        std::size_t size_;
+    };
+
+    /**
+     * @brief AliasTable sampling straight from mapped columns
+     *
+     * Returns exactly what the AliasTable it was built from returns for the
+     * same engine state.
+     */
+    class AliasTableView
+    {
+    public:
+        AliasTableView(const std::uint64_t* thresholds, const std::uint32_t* aliases, std::size_t size)
+            : thresholds_(thresholds), aliases_(aliases), size_(static_cast<std::uint32_t>(size))
+        {
+        }
+
+        template <typename Engine>
+        std::size_t sample(Engine& engine) const
+        {
+            return detail::sampleAlias(engine, thresholds_, aliases_, size_);
+        }
+
+        std::size_t sample() const
+        {
+            return sample(getRandomEngine());
+        }
+
+        std::size_t size() const { return size_; }
+
+    private:
+        const std::uint64_t* thresholds_;
+        const std::uint32_t* aliases_;
+        std::uint32_t size_;
+    };
+
+    /**
+     * @brief Generates seed-derived tables and writes them to a table file
+     *
+     * Tables are only described by the add* calls; their contents are
+     * generated while write() streams the file, so a builder for several
+     * hundred MB of tables never holds more than one table in memory.
+     * The output is a pure function of the seed, the table list and
+     * randomTableAlgorithmVersion.
+     *
+     * @code
+     * RandomTableBuilder builder(worldSeed);
+     * builder.addRandomWords("spawn", 1 << 24).addPermutation("noise", 256);
+     * builder.write("world.tables");
+     * @endcode
+     */
+    class RandomTableBuilder
+    {
+    public:
+        explicit RandomTableBuilder(std::uint64_t seed)
+            : seed_(seed)
+        {
+        }
+
+        std::uint64_t seed() const { return seed_; }
+
+        /**
+         * @brief Adds count uniformly random 64-bit words
+         *
+         * @throws std::invalid_argument if the name is invalid or taken, or count is 0
+         */
+        RandomTableBuilder& addRandomWords(const std::string& name, std::size_t count)
+        {
+            if (count == 0) {
+                throw std::invalid_argument("stevensMathLib::RandomTableBuilder - table must not be empty");
+            }
+            addTable(name, RandomTableKind::Words, count, {});
+            return *this;
+        }
+
+        /**
+         * @brief Adds a uniformly shuffled permutation of 0..size-1 (Fisher-Yates)
+         *
+         * @throws std::invalid_argument if the name is invalid or taken, or
+         *         size is 0 or above 2^32
+         */
+        RandomTableBuilder& addPermutation(const std::string& name, std::uint64_t size)
+        {
+            if (size == 0 || size > (std::uint64_t{1} << 32)) {
+                throw std::invalid_argument("stevensMathLib::RandomTableBuilder - permutation size must be 1 to 2^32");
+            }
+            addTable(name, RandomTableKind::Permutation, size, {});
+            return *this;
+        }
+
+        /**
+         * @brief Adds the alias table for a fixed discrete distribution
+         *
+         * @throws std::invalid_argument if the name is invalid or taken, or
+         *         the weights are rejected by AliasTable
+         */
+        RandomTableBuilder& addAliasTable(const std::string& name, const std::vector<double>& weights)
+        {
+            // Validate now rather than halfway through write()
+            const AliasTable table(weights);
+            addTable(name, RandomTableKind::Alias, table.size(), weights);
+            return *this;
+        }
+
+        /**
+         * @brief Writes the table file
+         *
+         * The file is written to a uniquely named temporary next to path,
+         * flushed to disk and renamed into place, so a process opening path
+         * sees either the previous file or the complete new one, never a
+         * partial write. Several processes may build the same path at once;
+         * the last rename wins.
+         *
+         * @throws std::runtime_error if the file cannot be written
+         */
+        void write(const std::string& path) const
+        {
+            std::string temporaryPath = path + ".tmp.XXXXXX";
+            std::FILE* file = createTemporary(temporaryPath);
+            if (file == nullptr) {
+                throw std::runtime_error("stevensMathLib::RandomTableBuilder - cannot create a file next to " + path);
+            }
+
+            bool written = writeTo(file) && std::fflush(file) == 0;
+#if defined(STEVENSMATHLIB_HAS_MMAP)
+            written = written && ::fsync(::fileno(file)) == 0;
+#endif
+            written = std::fclose(file) == 0 && written;
+            if (!written || std::rename(temporaryPath.c_str(), path.c_str()) != 0) {
+                std::remove(temporaryPath.c_str());
+                throw std::runtime_error("stevensMathLib::RandomTableBuilder - cannot write " + path);
+            }
+        }
+
+    private:
+        struct TableSpec
+        {
+            std::string name;
+            RandomTableKind kind;
+            std::uint64_t count;
+            std::vector<double> weights;
+        };
+
+        void addTable(const std::string& name, RandomTableKind kind, std::uint64_t count, std::vector<double> weights)
+        {
+            if (name.empty() || name.size() > randomTableMaxNameLength || name.find('\0') != std::string::npos) {
+                throw std::invalid_argument("stevensMathLib::RandomTableBuilder - table names must be 1 to 23 chars");
+            }
+            for (const TableSpec& table : tables_) {
+                if (table.name == name) {
+                    throw std::invalid_argument("stevensMathLib::RandomTableBuilder - duplicate table name " + name);
+                }
+            }
+            tables_.push_back({name, kind, count, std::move(weights)});
+        }
+
+        /**
+         * @brief Opens a new file whose name replaces the trailing XXXXXX of path
+         *
+         * Unique per call, so concurrent builders never share a temporary.
+         */
+        static std::FILE* createTemporary(std::string& path)
+        {
+#if defined(STEVENSMATHLIB_HAS_MMAP)
+            const int fd = ::mkstemp(&path[0]);
+            if (fd < 0) {
+                return nullptr;
+            }
+            // mkstemp creates the file owner-only; the tables are meant to be shared
+            ::fchmod(fd, 0644);
+            std::FILE* file = ::fdopen(fd, "wb");
+            if (file == nullptr) {
+                ::close(fd);
+                std::remove(path.c_str());
+            }
+            return file;
+#else
+            std::random_device device;
+            static constexpr char hexDigits[] = "0123456789abcdef";
+            for (std::size_t i = path.size() - 6; i < path.size(); ++i) {
+                path[i] = hexDigits[device() & 15u];
+            }
+            return std::fopen(path.c_str(), "wbx");
+#endif
+        }
+
+        bool writeTo(std::FILE* file) const
+        {
+            detail::RandomTableHeader header = {};
+            std::memcpy(header.magic, detail::randomTableMagic, sizeof(header.magic));
+            header.formatVersion = randomTableFormatVersion;
+            header.byteOrderMark = detail::randomTableByteOrderMark;
+            header.seed = seed_;
+            header.algorithmVersion = randomTableAlgorithmVersion;
+            header.tableCount = static_cast<std::uint32_t>(tables_.size());
+
+            std::vector<detail::RandomTableEntry> directory(tables_.size());
+            std::uint64_t offset = detail::tableDataStart(tables_.size());
+            for (std::size_t i = 0; i < tables_.size(); ++i) {
+                detail::RandomTableEntry& entry = directory[i];
+                entry = {};
+                std::memcpy(entry.name, tables_[i].name.data(), tables_[i].name.size());
+                entry.kind = static_cast<std::uint32_t>(tables_[i].kind);
+                entry.offset = offset;
+                entry.count = tables_[i].count;
+                offset = detail::alignTableOffset(offset + detail::tableBytes(tables_[i].kind, tables_[i].count));
+            }
+            header.fileSize = offset;
+
+            // Payload first; the header goes in last, once the checksum is known
+            if (std::fseek(file, static_cast<long>(detail::tableDataStart(tables_.size())), SEEK_SET) != 0) {
+                return false;
+            }
+            detail::RandomTableWriter writer(file);
+            writer.startPayload(detail::tableDataStart(tables_.size()));
+            for (std::size_t i = 0; i < tables_.size(); ++i) {
+                if (!writer.padTo(directory[i].offset) || !writeTable(writer, tables_[i])) {
+                    return false;
+                }
+            }
+            if (!writer.padTo(header.fileSize)) {
+                return false;
+            }
+
+            header.payloadChecksum = writer.checksum();
+            const std::size_t directoryBytes = directory.size() * sizeof(detail::RandomTableEntry);
+            header.directoryChecksum = detail::directoryChecksum(header, directory.data(), directoryBytes);
+
+            detail::RandomTableWriter headerWriter(file);
+            return std::fseek(file, 0, SEEK_SET) == 0 && headerWriter.write(&header, sizeof(header)) &&
+                   headerWriter.write(directory.data(), directoryBytes) &&
+                   headerWriter.padTo(detail::tableDataStart(tables_.size()));
+        }
+
+        bool writeTable(detail::RandomTableWriter& writer, const TableSpec& table) const
+        {
+            std::mt19937_64 engine = detail::tableEngine(seed_, table.name);
+
+            switch (table.kind) {
+            case RandomTableKind::Words: {
+                std::vector<std::uint64_t> chunk(std::min<std::uint64_t>(table.count, 8192));
+                for (std::uint64_t remaining = table.count; remaining > 0;) {
+                    const std::size_t take = static_cast<std::size_t>(std::min<std::uint64_t>(remaining, chunk.size()));
+                    for (std::size_t i = 0; i < take; ++i) {
+                        chunk[i] = engine();
+                    }
+                    if (!writer.write(chunk.data(), take * sizeof(std::uint64_t))) {
+                        return false;
+                    }
+                    remaining -= take;
+                }
+                return true;
+            }
+            case RandomTableKind::Permutation: {
+                // Padded to an even count so every write stays a multiple of 8 bytes
+                std::vector<std::uint32_t> values(static_cast<std::size_t>((table.count + 1) & ~std::uint64_t{1}), 0);
+                for (std::uint64_t i = 0; i < table.count; ++i) {
+                    values[static_cast<std::size_t>(i)] = static_cast<std::uint32_t>(i);
+                }
+                for (std::uint64_t i = table.count - 1; i > 0; --i) {
+                    const std::uint64_t j = detail::boundedRandom64(engine, i + 1);
+                    std::swap(values[static_cast<std::size_t>(i)], values[static_cast<std::size_t>(j)]);
+                }
+                return writer.write(values.data(), values.size() * sizeof(std::uint32_t));
+            }
+            case RandomTableKind::Alias: {
+                const AliasTable alias(table.weights);
+                std::vector<std::uint32_t> aliases = alias.aliases();
+                aliases.resize((aliases.size() + 1) & ~std::size_t{1}, 0);
+                return writer.write(alias.thresholds().data(), alias.size() * sizeof(std::uint64_t)) &&
+                       writer.write(aliases.data(), aliases.size() * sizeof(std::uint32_t));
+            }
+            }
+            return false;
+        }
+
+        std::uint64_t seed_;
+        std::vector<TableSpec> tables_;
+    };
+
+    /**
+     * @brief A loaded table file
+     *
+     * Opening validates the header against the expected seed and against
+     * randomTableFormatVersion and randomTableAlgorithmVersion, and
+     * checksums the directory; it does not touch the table pages, so opening
+     * a large file is cheap and only the pages a process reads are faulted
+     * in. verify() checksums the table contents as well.
+     *
+     * Views returned by the accessors point into the mapping and stay valid
+     * while this object lives. Move-only.
+     */
+    class RandomTables
+    {
+    public:
+        /**
+         * @brief Opens and validates a table file
+         *
+         * @param path File written by RandomTableBuilder::write()
+         * @param expectedSeed Seed the caller expects the tables to be built from
+         * @param loading Map to share pages between processes, Read to copy
+         *
+         * @throws std::runtime_error if the file cannot be read, is not a
+         *         table file, was built by a different format or algorithm
+         *         version or for a different seed, or is truncated or corrupt
+         */
+        RandomTables(const std::string& path, std::uint64_t expectedSeed, TableLoading loading = TableLoading::Map)
+        {
+            if (loading == TableLoading::Map) {
+                mapFile(path);
+            }
+            if (data_ == nullptr) {
+                readFile(path);
+            }
+            validate(expectedSeed);
+        }
+
+        RandomTables(RandomTables&& other) noexcept
+        {
+            moveFrom(other);
+        }
+
+        RandomTables& operator=(RandomTables&& other) noexcept
+        {
+            if (this != &other) {
+                release();
+                moveFrom(other);
+            }
+            return *this;
+        }
+
+        RandomTables(const RandomTables&) = delete;
+        RandomTables& operator=(const RandomTables&) = delete;
+
+        ~RandomTables()
+        {
+            release();
+        }
+
+        std::uint64_t seed() const { return header_.seed; }
+        std::uint32_t algorithmVersion() const { return header_.algorithmVersion; }
+        std::size_t tableCount() const { return directory_.size(); }
+        std::size_t sizeBytes() const { return size_; }
+
+        /**
+         * @brief Whether the file is shared via mmap rather than copied
+         */
+        bool isMapped() const { return mapped_; }
+
+        bool contains(const std::string& name) const { return findEntry(name) != nullptr; }
+
+        /**
+         * @brief Checksums every table; reads the whole file
+         */
+        bool verify() const
+        {
+            const std::uint64_t start = detail::tableDataStart(directory_.size());
+            return detail::tableChecksum(detail::tableChecksumBasis, data_ + start, size_ - start) ==
+                   header_.payloadChecksum;
+        }
+
+        /**
+         * @throws std::out_of_range if there is no table with that name
+         * @throws std::invalid_argument if the table is of another kind
+         */
+        RandomWordsView randomWords(const std::string& name) const
+        {
+            const detail::RandomTableEntry& entry = entryOfKind(name, RandomTableKind::Words);
+            return RandomWordsView(pointerAt<std::uint64_t>(entry.offset), static_cast<std::size_t>(entry.count));
+        }
+
+        /**
+         * @throws std::out_of_range if there is no table with that name
+         * @throws std::invalid_argument if the table is of another kind
+         */
+        PermutationTableView permutation(const std::string& name) const
+        {
+            const detail::RandomTableEntry& entry = entryOfKind(name, RandomTableKind::Permutation);
+            return PermutationTableView(pointerAt<std::uint32_t>(entry.offset), static_cast<std::size_t>(entry.count));
+        }
+
+        /**
+         * @brief An alias table view; checks every alias index once
+         *
+         * @throws std::out_of_range if there is no table with that name
+         * @throws std::invalid_argument if the table is of another kind
+         * @throws std::runtime_error if an alias points outside the table
+         */
+        AliasTableView aliasTable(const std::string& name) const
+        {
+            const detail::RandomTableEntry& entry = entryOfKind(name, RandomTableKind::Alias);
+            const std::uint64_t* thresholds = pointerAt<std::uint64_t>(entry.offset);
+            const std::uint32_t* aliases = pointerAt<std::uint32_t>(entry.offset + entry.count * sizeof(std::uint64_t));
+            for (std::uint64_t i = 0; i < entry.count; ++i) {
+                if (aliases[i] >= entry.count) {
+                    throw std::runtime_error("stevensMathLib::RandomTables - corrupt alias table " + name);
+                }
+            }
+            return AliasTableView(thresholds, aliases, static_cast<std::size_t>(entry.count));
+        }
+
+    private:
+        void mapFile(const std::string& path)
+        {
+#if defined(STEVENSMATHLIB_HAS_MMAP)
+            const int fd = ::open(path.c_str(), O_RDONLY | O_CLOEXEC);
+            if (fd < 0) {
+                throw std::runtime_error("stevensMathLib::RandomTables - cannot open " + path);
+            }
+            struct stat status;
+            if (::fstat(fd, &status) != 0 || status.st_size <= 0) {
+                ::close(fd);
+                throw std::runtime_error("stevensMathLib::RandomTables - cannot read " + path);
+            }
+
+            const std::size_t size = static_cast<std::size_t>(status.st_size);
+            void* mapping = ::mmap(nullptr, size, PROT_READ, MAP_SHARED, fd, 0);
+            ::close(fd); // The mapping keeps the file alive
+            if (mapping != MAP_FAILED) {
+                data_ = static_cast<const unsigned char*>(mapping);
+                size_ = size;
+                mapped_ = true;
+            }
+#else
+            (void)path;
+#endif
+        }
+
+        void readFile(const std::string& path)
+        {
+            std::FILE* file = std::fopen(path.c_str(), "rb");
+            if (file == nullptr) {
+                throw std::runtime_error("stevensMathLib::RandomTables - cannot open " + path);
+            }
+
+            long size = -1;
+            if (std::fseek(file, 0, SEEK_END) == 0) {
+                size = std::ftell(file);
+            }
+            // Words, not bytes, so the uint64_t tables are aligned
+            const std::size_t words = size > 0 ? (static_cast<std::size_t>(size) + 7) / 8 : 0;
+            buffer_.reset(new std::uint64_t[words > 0 ? words : 1]);
+            const bool read = size > 0 && std::fseek(file, 0, SEEK_SET) == 0 &&
+                              std::fread(buffer_.get(), 1, static_cast<std::size_t>(size), file) ==
+                                  static_cast<std::size_t>(size);
+            std::fclose(file);
+            if (!read) {
+                buffer_.reset();
+                throw std::runtime_error("stevensMathLib::RandomTables - cannot read " + path);
+            }
+
+            data_ = reinterpret_cast<const unsigned char*>(buffer_.get());
+            size_ = static_cast<std::size_t>(size);
+        }
+
+        void validate(std::uint64_t expectedSeed)
+        {
+            try {
+                validateHeader(expectedSeed);
+            } catch (...) {
+                release();
+                throw;
+            }
+        }
+
+        void validateHeader(std::uint64_t expectedSeed)
+        {
+            if (size_ < sizeof(header_)) {
+                fail("file is too small");
+            }
+            std::memcpy(&header_, data_, sizeof(header_));
+
+            if (std::memcmp(header_.magic, detail::randomTableMagic, sizeof(header_.magic)) != 0) {
+                fail("not a table file");
+            }
+            if (header_.byteOrderMark != detail::randomTableByteOrderMark) {
+                fail("file was built on a machine with the other byte order");
+            }
+            if (header_.formatVersion != randomTableFormatVersion) {
+                fail("unsupported format version " + std::to_string(header_.formatVersion));
+            }
+            if (header_.algorithmVersion != randomTableAlgorithmVersion) {
+                fail("file was built by algorithm version " + std::to_string(header_.algorithmVersion) +
+                     ", expected " + std::to_string(randomTableAlgorithmVersion));
+            }
+            if (header_.seed != expectedSeed) {
+                fail("file was built for seed " + std::to_string(header_.seed) + ", expected " +
+                     std::to_string(expectedSeed));
+            }
+            if (header_.fileSize != size_ || detail::tableDataStart(header_.tableCount) > size_) {
+                fail("file is truncated");
+            }
+
+            directory_.resize(header_.tableCount);
+            const std::size_t directoryBytes = directory_.size() * sizeof(detail::RandomTableEntry);
+            std::memcpy(directory_.data(), data_ + sizeof(header_), directoryBytes);
+            if (detail::directoryChecksum(header_, directory_.data(), directoryBytes) != header_.directoryChecksum) {
+                fail("directory checksum mismatch");
+            }
+
+            for (const detail::RandomTableEntry& entry : directory_) {
+                // A count above the file size cannot fit, and would overflow tableBytes()
+                const RandomTableKind kind = static_cast<RandomTableKind>(entry.kind);
+                const std::uint64_t bytes = entry.count <= size_ ? detail::tableBytes(kind, entry.count) : 0;
+                if (bytes == 0 || entry.count > maxTableCount(kind) || entry.offset % detail::randomTableAlignment != 0 ||
+                    entry.offset > size_ || bytes > size_ - entry.offset ||
+                    entry.name[randomTableMaxNameLength] != '\0') {
+                    fail("directory entry out of bounds");
+                }
+            }
+        }
+
+        static std::uint64_t maxTableCount(RandomTableKind kind)
+        {
+            switch (kind) {
+            case RandomTableKind::Words:
+                return std::numeric_limits<std::uint64_t>::max();
+            case RandomTableKind::Permutation:
+                return std::uint64_t{1} << 32;
+            case RandomTableKind::Alias:
+                return std::numeric_limits<std::uint32_t>::max();
+            }
+            return 0;
+        }
+
+        [[noreturn]] static void fail(const std::string& reason)
+        {
+            throw std::runtime_error("stevensMathLib::RandomTables - " + reason);
+        }
+
+        const detail::RandomTableEntry* findEntry(const std::string& name) const
+        {
+            for (const detail::RandomTableEntry& entry : directory_) {
+                if (name.size() <= randomTableMaxNameLength &&
+                    std::strncmp(entry.name, name.c_str(), sizeof(entry.name)) == 0) {
+                    return &entry;
+                }
+            }
+            return nullptr;
+        }
+
+        const detail::RandomTableEntry& entryOfKind(const std::string& name, RandomTableKind kind) const
+        {
+            const detail::RandomTableEntry* entry = findEntry(name);
+            if (entry == nullptr) {
+                throw std::out_of_range("stevensMathLib::RandomTables - no table named " + name);
+            }
+            if (entry->kind != static_cast<std::uint32_t>(kind)) {
+                throw std::invalid_argument("stevensMathLib::RandomTables - table " + name + " is of another kind");
+            }
+            return *entry;
+        }
+
+        template <typename T>
+        const T* pointerAt(std::uint64_t offset) const
+        {
+            return reinterpret_cast<const T*>(data_ + offset);
+        }
+
+        void release()
+        {
+#if defined(STEVENSMATHLIB_HAS_MMAP)
+            if (mapped_) {
+                ::munmap(const_cast<unsigned char*>(data_), size_);
+            }
+#endif
+            buffer_.reset();
+            data_ = nullptr;
+            size_ = 0;
+            mapped_ = false;
+        }
+
+        void moveFrom(RandomTables& other)
+        {
+            data_ = other.data_;
+            size_ = other.size_;
+            mapped_ = other.mapped_;
+            buffer_ = std::move(other.buffer_);
+            header_ = other.header_;
+            directory_ = std::move(other.directory_);
+            other.data_ = nullptr;
+            other.size_ = 0;
+            other.mapped_ = false;
+        }
+
+        const unsigned char* data_ = nullptr;
+        std::size_t size_ = 0;
+        bool mapped_ = false;
+        std::unique_ptr<std::uint64_t[]> buffer_;
+        detail::RandomTableHeader header_ = {};
+        std::vector<detail::RandomTableEntry> directory_;
+    };
+} // namespace stevensMathLib
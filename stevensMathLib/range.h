@@ -0,0 +1,51 @@
+/**
+ * stevensMathLib/range.h
+ *
+ * Range checking: BoundType and in_range().
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Specifies whether range bounds are inclusive or exclusive
+     */
+    enum class BoundType
+    {
+        Inclusive,  // Uses >= and <= comparisons
+        Exclusive   // Uses > and < comparisons
+    };
+
+    /**
+     * @brief Checks if a value falls within a specified range
+     *
+     * @tparam T The numeric type (must support comparison operators)
+     * @param value The value to check
+     * @param lowerBound The lower bound of the range
+     * @param upperBound The upper bound of the range
+     * @param boundType Whether bounds are inclusive or exclusive
+     * @return true if value is within the range, false otherwise
+     *
+     * Example:
+     *   in_range(5, 0, 10, BoundType::Inclusive)  -> true
+     *   in_range(10, 0, 10, BoundType::Exclusive) -> false
+     */
+    template <typename T>
+    bool in_range(const T& value,
+                  const T& lowerBound,
+                  const T& upperBound,
+                  BoundType boundType = BoundType::Inclusive)
+    {
+        if (boundType == BoundType::Inclusive) {
+            return (value >= lowerBound) && (value <= upperBound);
+        }
+
+        return (value > lowerBound) && (value < upperBound);
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,423 @@
+/**
+ * stevensMathLib/range_math.h
+ *
+ * clamp, remap, lerp, inverseLerp and smoothstep, scalar and batch.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "config.h"
+#include "range.h"
+
+#include <cmath>
+#include <cstddef>
+#include <stdexcept>
+#include <string>
+#include <type_traits>
+
+namespace stevensMathLib
+{
+    namespace detail
+    {
+        /**
+         * @brief Tightest [lower, upper] holding every value in_range() accepts for these bounds
+         *
+         * Exclusive integer bounds move in by one; exclusive floating point
+         * bounds move in by one ulp.
+         */
+        template <typename T>
+        void clampLimits(T& lowerBound, T& upperBound, BoundType boundType, const char* functionName)
+        {
+            if (upperBound < lowerBound) {
+                throw std::invalid_argument(std::string("stevensMathLib::") + functionName
+                                            + " - upperBound must not be less than lowerBound");
+            }
+            if (boundType == BoundType::Inclusive) {
+                return;
+            }
+            if (!(lowerBound < upperBound)) {
+                throw std::invalid_argument(std::string("stevensMathLib::") + functionName
+                                            + " - exclusive range is empty");
+            }
+            if constexpr (std::is_floating_point_v<T>) {
+                const T lower = std::nextafter(lowerBound, upperBound);
+                upperBound = std::nextafter(upperBound, lowerBound);
+                lowerBound = lower;
+            } else {
+                // lowerBound < upperBound here, so the +1 cannot overflow (the
+                // difference can, e.g. for INT_MIN..INT_MAX)
+                if (!(lowerBound + 1 < upperBound)) {
+                    throw std::invalid_argument(std::string("stevensMathLib::") + functionName
+                                                + " - exclusive range is empty");
+                }
+                ++lowerBound;
+                --upperBound;
+            }
+        }
+
+        template <typename T>
+        T checkedSpan(T lowerBound, T upperBound, const char* functionName)
+        {
+            if (lowerBound == upperBound) {
+                throw std::invalid_argument(std::string("stevensMathLib::") + functionName
+                                            + " - range must not be empty");
+            }
+            return upperBound - lowerBound;
+        }
+
+        // The element-wise operations. Batch and scalar entry points share
+        // them, so both return identical results on every kernel.
+        template <typename T>
+        struct ClampOp
+        {
+            T lowerBound;
+            T upperBound;
+
+            T operator()(T value) const
+            {
+                return value < lowerBound ? lowerBound : (upperBound < value ? upperBound : value);
+            }
+        };
+
+        template <typename T>
+        struct LerpOp
+        {
+            T start;
+            T end;
+
+            // Exact at t = 0 and t = 1, unlike start + t * (end - start)
+            T operator()(T t) const { return (T(1) - t) * start + t * end; }
+        };
+
+        template <typename T>
+        struct InverseLerpOp
+        {
+            T start;
+            T span;
+
+            T operator()(T value) const { return (value - start) / span; }
+        };
+
+        // Clamps the input to the edges rather than t to [0, 1]: the result is
+        // the same and the selects on runtime bounds vectorize
+        template <typename T>
+        struct SmoothstepOp
+        {
+            T edge0;
+            T span;
+            T lowerEdge;
+            T upperEdge;
+
+            T operator()(T value) const
+            {
+                const T clamped = value < lowerEdge ? lowerEdge : (upperEdge < value ? upperEdge : value);
+                const T t = (clamped - edge0) / span;
+                return t * t * (T(3) - T(2) * t);
+            }
+        };
+
+        template <typename T>
+        SmoothstepOp<T> makeSmoothstepOp(T edge0, T edge1, const char* functionName)
+        {
+            const T span = checkedSpan(edge0, edge1, functionName);
+            return {edge0, span, edge0 < edge1 ? edge0 : edge1, edge0 < edge1 ? edge1 : edge0};
+        }
+
+        // Integers are remapped in double precision and rounded half away from zero
+        template <typename T>
+        struct RemapOp
+        {
+            using Real = std::conditional_t<std::is_floating_point_v<T>, T, double>;
+
+            Real fromLower;
+            Real fromSpan;
+            Real toLower;
+            Real toUpper;
+
+            T operator()(T value) const
+            {
+                const Real t = (static_cast<Real>(value) - fromLower) / fromSpan;
+                const Real mapped = (Real(1) - t) * toLower + t * toUpper;
+                if constexpr (std::is_floating_point_v<T>) {
+                    return mapped;
+                } else {
+                    return static_cast<T>(mapped + (mapped < 0.0 ? -0.5 : 0.5));
+                }
+            }
+        };
+
+        /**
+         * @brief Applies op to count values, one 64-byte block at a time
+         *
+         * The block loop has a fixed trip count, so the compiler vectorizes it
+         * without a runtime epilogue; the tail runs scalar. values and out must
+         * not overlap (the in-place case goes through applyRangeOpInPlace). op
+         * is taken by value so its parameters stay in registers.
+         */
+        template <typename T, typename Op>
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void applyRangeOp(const T* __restrict values, T* __restrict out, std::size_t count, Op op)
+        {
+            constexpr std::size_t block = 64 / sizeof(T);
+
+            std::size_t i = 0;
+            for (; i + block <= count; i += block) {
+                for (std::size_t j = 0; j < block; ++j) {
+                    out[i + j] = op(values[i + j]);
+                }
+            }
+            for (; i < count; ++i) {
+                out[i] = op(values[i]);
+            }
+        }
+
+        template <typename T, typename Op>
+#if defined(__GNUC__)
+        __attribute__((always_inline))
+#endif
+        inline void applyRangeOpInPlace(T* data, std::size_t count, Op op)
+        {
+            constexpr std::size_t block = 64 / sizeof(T);
+
+            std::size_t i = 0;
+            for (; i + block <= count; i += block) {
+                for (std::size_t j = 0; j < block; ++j) {
+                    data[i + j] = op(data[i + j]);
+                }
+            }
+            for (; i < count; ++i) {
+                data[i] = op(data[i]);
+            }
+        }
+
+        template <typename T, typename Op>
+        void applyRangeOpScalar(const T* values, T* out, std::size_t count, Op op)
+        {
+            if (values == out) {
+                applyRangeOpInPlace(out, count, op);
+            } else {
+                applyRangeOp(values, out, count, op);
+            }
+        }
+
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+        template <typename T, typename Op>
+        __attribute__((target("avx2"))) void applyRangeOpAvx2(const T* values, T* out, std::size_t count, Op op)
+        {
+            if (values == out) {
+                applyRangeOpInPlace(out, count, op);
+            } else {
+                applyRangeOp(values, out, count, op);
+            }
+        }
+#endif
+
+        inline bool rangeKernelsUseAvx2()
+        {
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+            static const bool supported = [] {
+                __builtin_cpu_init();
+                return __builtin_cpu_supports("avx2") != 0;
+            }();
+            return supported;
+#else
+            return false;
+#endif
+        }
+
+        template <typename T, typename Op>
+        void runRangeOp(const T* values, T* out, std::size_t count, Op op)
+        {
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+            if (rangeKernelsUseAvx2()) {
+                applyRangeOpAvx2(values, out, count, op);
+                return;
+            }
+#endif
+            applyRangeOpScalar(values, out, count, op);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Name of the kernel the batch functions below run on: "avx2" or "scalar"
+     */
+    inline const char* activeRangeKernel()
+    {
+        return detail::rangeKernelsUseAvx2() ? "avx2" : "scalar";
+    }
+
+    /**
+     * @brief Clamps a value into a range
+     *
+     * @tparam T The numeric type
+     * @param value The value to clamp
+     * @param lowerBound The lower bound of the range
+     * @param upperBound The upper bound of the range
+     * @param boundType Whether bounds are inclusive or exclusive
+     * @return The closest value that in_range() accepts with the same arguments
+     *
+     * @throws std::invalid_argument if upperBound < lowerBound, or if an exclusive range is empty
+     *
+     * With BoundType::Exclusive, integers clamp to lowerBound + 1 / upperBound - 1
+     * and floating point values to one ulp inside each bound. NaN is returned unchanged.
+     *
+     * Example:
+     *   clamp(12, 0, 10, BoundType::Inclusive) -> 10
+     *   clamp(12, 0, 10, BoundType::Exclusive) -> 9
+     */
+    template <typename T>
+    T clamp(const T& value,
+            T lowerBound,
+            T upperBound,
+            BoundType boundType = BoundType::Inclusive)
+    {
+        detail::clampLimits(lowerBound, upperBound, boundType, "clamp");
+        return detail::ClampOp<T>{lowerBound, upperBound}(value);
+    }
+
+    /**
+     * @brief Linearly maps a value from [fromLower, fromUpper] to [toLower, toUpper]
+     *
+     * @return toLower when value == fromLower and toUpper when value == fromUpper;
+     *         values outside the source range extrapolate
+     *
+     * @throws std::invalid_argument if fromLower == fromUpper
+     *
+     * Integer types are mapped in double precision and rounded half away from
+     * zero; the result must fit in T. Either range may be reversed.
+     *
+     * Example: remap(5.0f, 0.0f, 10.0f, 100.0f, 200.0f) returns 150.0f
+     */
+    template <typename T>
+    T remap(const T& value, const T& fromLower, const T& fromUpper, const T& toLower, const T& toUpper)
+    {
+        static_assert(std::is_arithmetic_v<T>, "remap requires an arithmetic type");
+        using Real = typename detail::RemapOp<T>::Real;
+        const Real span = static_cast<Real>(fromUpper) - static_cast<Real>(fromLower);
+        if (span == Real(0)) {
+            throw std::invalid_argument("stevensMathLib::remap - source range must not be empty");
+        }
+        return detail::RemapOp<T>{static_cast<Real>(fromLower), span,
+                                  static_cast<Real>(toLower), static_cast<Real>(toUpper)}(value);
+    }
+
+    /**
+     * @brief Linear interpolation: start at t = 0, end at t = 1
+     *
+     * Computed as (1 - t) * start + t * end, which is exact at both ends.
+     * t outside [0, 1] extrapolates.
+     */
+    template <typename T>
+    T lerp(const T& start, const T& end, const T& t)
+    {
+        static_assert(std::is_floating_point_v<T>, "lerp requires a floating point type");
+        return detail::LerpOp<T>{start, end}(t);
+    }
+
+    /**
+     * @brief Inverse of lerp(): where value lies between start (0) and end (1)
+     *
+     * @throws std::invalid_argument if start == end
+     */
+    template <typename T>
+    T inverseLerp(const T& start, const T& end, const T& value)
+    {
+        static_assert(std::is_floating_point_v<T>, "inverseLerp requires a floating point type");
+        return detail::InverseLerpOp<T>{start, detail::checkedSpan(start, end, "inverseLerp")}(value);
+    }
+
+    /**
+     * @brief Hermite smoothstep: 0 at or below edge0, 1 at or above edge1, smooth in between
+     *
+     * Matches GLSL smoothstep(); edges may be given in descending order.
+     *
+     * @throws std::invalid_argument if edge0 == edge1
+     */
+    template <typename T>
+    T smoothstep(const T& edge0, const T& edge1, const T& value)
+    {
+        static_assert(std::is_floating_point_v<T>, "smoothstep requires a floating point type");
+        return detail::makeSmoothstepOp(edge0, edge1, "smoothstep")(value);
+    }
+
+    /**
+     * @brief clamp() over an array; out may equal values for in-place use
+     *
+     * Bounds are validated once, then the values run through an AVX2 kernel
+     * when the CPU has one (scalar otherwise). Results match clamp() exactly.
+     *
+     * Example:
+     *   clampBatch(heights.data(), heights.data(), heights.size(), 0.0f, 100.0f);
+     */
+    template <typename T>
+    void clampBatch(const T* values, T* out, std::size_t count,
+                    T lowerBound, T upperBound,
+                    BoundType boundType = BoundType::Inclusive)
+    {
+        static_assert(std::is_arithmetic_v<T>, "clampBatch requires an arithmetic type");
+        detail::clampLimits(lowerBound, upperBound, boundType, "clampBatch");
+        detail::runRangeOp(values, out, count, detail::ClampOp<T>{lowerBound, upperBound});
+    }
+
+    /**
+     * @brief remap() over an array; out may equal values
+     *
+     * @throws std::invalid_argument if fromLower == fromUpper
+     */
+    template <typename T>
+    void remapBatch(const T* values, T* out, std::size_t count,
+                    T fromLower, T fromUpper, T toLower, T toUpper)
+    {
+        static_assert(std::is_arithmetic_v<T>, "remapBatch requires an arithmetic type");
+        using Real = typename detail::RemapOp<T>::Real;
+        const Real span = static_cast<Real>(fromUpper) - static_cast<Real>(fromLower);
+        if (span == Real(0)) {
+            throw std::invalid_argument("stevensMathLib::remapBatch - source range must not be empty");
+        }
+        detail::runRangeOp(values, out, count,
+                           detail::RemapOp<T>{static_cast<Real>(fromLower), span,
+                                              static_cast<Real>(toLower), static_cast<Real>(toUpper)});
+    }
+
+    /**
+     * @brief lerp(start, end, t) for every t in an array; out may equal ts
+     */
+    template <typename T>
+    void lerpBatch(const T* ts, T* out, std::size_t count, T start, T end)
+    {
+        static_assert(std::is_floating_point_v<T>, "lerpBatch requires a floating point type");
+        detail::runRangeOp(ts, out, count, detail::LerpOp<T>{start, end});
+    }
+
+    /**
+     * @brief inverseLerp(start, end, value) over an array; out may equal values
+     *
+     * @throws std::invalid_argument if start == end
+     */
+    template <typename T>
+    void inverseLerpBatch(const T* values, T* out, std::size_t count, T start, T end)
+    {
+        static_assert(std::is_floating_point_v<T>, "inverseLerpBatch requires a floating point type");
+        detail::runRangeOp(values, out, count,
+                           detail::InverseLerpOp<T>{start, detail::checkedSpan(start, end, "inverseLerpBatch")});
+    }
+
+    /**
+     * @brief smoothstep(edge0, edge1, value) over an array; out may equal values
+     *
+     * @throws std::invalid_argument if edge0 == edge1
+     */
+    template <typename T>
+    void smoothstepBatch(const T* values, T* out, std::size_t count, T edge0, T edge1)
+    {
+        static_assert(std::is_floating_point_v<T>, "smoothstepBatch requires a floating point type");
+        detail::runRangeOp(values, out, count, detail::makeSmoothstepOp(edge0, edge1, "smoothstepBatch"));
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,98 @@
+/**
+ * stevensMathLib/rounding.h
+ *
+ * Rounding helpers for floating point values.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "instrumentation.h"
+
+#include <cmath>
+#include <cstdio>
+#include <cstdlib>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Checks if a value has no fractional part
+     *
+     * @param value The value to check
+     * @return true if the value equals its floor (no fractional part)
+     */
+    inline bool isWholeNumber(float value)
+    {
+        return std::floor(value) == value;
+    }
+
+    /**
+     * @brief Rounds a number to the nearest tenth
+     *
+     * @param numberToRound The number to round
+     * @return The number rounded to one decimal place, or as an integer if whole
+     *
+     * If the number has no decimal part (or rounds to a whole number),
+     * returns it as an integer. Otherwise, rounds to the nearest tenth.
+     */
+    inline float roundToNearest10th(float numberToRound)
+    {
+        if (isWholeNumber(numberToRound)) {
+            return static_cast<int>(numberToRound);
+        }
+
+        const float roundedValue = std::round(numberToRound * 10.0f) / 10.0f;
+
+        if (isWholeNumber(roundedValue)) {
+            return static_cast<int>(roundedValue);
+        }
+
+        return roundedValue;
+    }
+
+    namespace detail
+    {
+        /**
+         * @brief Warns about and corrects a negative decimal place count
+         *
+         * @param decimalPlaces The requested precision
+         * @param functionName Caller name used in the warning message
+         * @return The absolute value of decimalPlaces
+         */
+        inline int absolutePrecision(int decimalPlaces, const char* functionName)
+        {
+            if (decimalPlaces >= 0) {
+                return decimalPlaces;
+            }
+
+            countEvent(InstrumentationCounter::NegativePrecision);
+            std::fprintf(stderr, "Warning: negative precision (%d) provided to %s. Using absolute value.\n",
+                         decimalPlaces, functionName);
+            return std::abs(decimalPlaces);
+        }
+    } // namespace detail
+
+    /**
+     * @brief Rounds a number to a specified precision
+     *
+     * @param value The value to round
+     * @param decimalPlaces The number of decimal places to round to
+     * @return The value rounded to the specified decimal places
+     *
+     * @note Precision must be non-negative. For precision 0, rounds to integer.
+     *
+     * Example: round(3.14159, 2) returns 3.14
+     */
+    inline float round(float value, int decimalPlaces)
+    {
+        detail::countEvent(InstrumentationCounter::RoundCalls);
+        decimalPlaces = detail::absolutePrecision(decimalPlaces, "round()");
+
+        const float scaleFactor = std::pow(10.0f, decimalPlaces);
+        return std::round(value * scaleFactor) / scaleFactor;
+    }
+} // namespace stevensMathLib
@@ -0,0 +1,539 @@
+/**
+ * stevensMathLib/sampling.h
+ *
+ * Reservoir samplers and the AliasTable discrete sampler.
+ *
+ * Part of stevensMathLib; include "stevensMathLib.h" for the whole library.
+ *
+ * Copyright (c) 2025 Bucephalus-Studios
+ * Licensed under the MIT License
+ */
+
+#pragma once
+
+#include "random.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+namespace stevensMathLib
+{
+    /**
+     * @brief Uniform random sample of fixed size from a stream of unknown length
+     *
+     * @tparam T The item type
+     *
+     * Implements Li's Algorithm L: once the reservoir is full, the number of
+     * items to skip before the next replacement is drawn from a geometric
+     * distribution, so only O(k log(n/k)) random numbers are needed for n items.
+     * Each retained item carries a random key, which makes merging reservoirs
+     * built on different threads exact.
+     *
+     * Randomness comes from getRandomEngine(), so setSeed() makes samples reproducible.
+     *
+     * Example:
+     *   ReservoirSampler<Event> sampler(100);
+     *   for (const Event& event : stream) sampler.add(event);
+     *   std::vector<Event> representatives = sampler.sample();
+     */
+    template <typename T>
+    class ReservoirSampler
+    {
+    public:
+        /**
+         * @brief Creates an empty sampler
+         *
+         * @param capacity Number of items to keep (k)
+         *
+         * @throws std::invalid_argument if capacity is zero
+         */
+        explicit ReservoirSampler(std::size_t capacity)
+            : capacity_(capacity)
+        {
+            if (capacity == 0) {
+                throw std::invalid_argument(
+                    "stevensMathLib::ReservoirSampler - capacity must be greater than zero");
+            }
+            slots_.reserve(capacity);
+        }
+
+        /**
+         * @brief Offers one stream item to the sampler
+         */
+        void add(const T& item)
+        {
+            ++itemsSeen_;
+
+            if (slots_.size() < capacity_) {
+                fill(item);
+                return;
+            }
+            if (skipRemaining_ > 0) {
+                --skipRemaining_;
+                return;
+            }
+            replace(item);
+        }
+
+        /**
+         * @brief Offers count consecutive stream items to the sampler
+         *
+         * Skipped items are jumped over without being touched, so a large
+         * batch costs O(k log(n/k)) rather than O(n) once the reservoir is full.
+         */
+        void add(const T* items, std::size_t count)
+        {
+            std::size_t index = 0;
+            while (index < count && slots_.size() < capacity_) {
+                ++itemsSeen_;
+                fill(items[index++]);
+            }
+
+            while (index < count) {
+                const std::size_t remaining = count - index;
+                if (skipRemaining_ >= remaining) {
+                    skipRemaining_ -= remaining;
+                    itemsSeen_ += remaining;
+                    return;
+                }
+
+                index += static_cast<std::size_t>(skipRemaining_);
+                itemsSeen_ += skipRemaining_ + 1;
+                replace(items[index++]);
+            }
+        }
+
+        void add(const std::vector<T>& items)
+        {
+            add(items.data(), items.size());
+        }
+
+        /**
+         * @brief Folds in a sampler that saw a disjoint part of the stream
+         *
+         * The result is a uniform sample of both streams combined: the k items
+         * with the smallest keys across both reservoirs are kept.
+         *
+         * @throws std::invalid_argument if the capacities differ, or if other is
+         *         this sampler (its stream is not disjoint from itself)
+         */
+        void merge(const ReservoirSampler& other)
+        {
+            if (&other == this) {
+                throw std::invalid_argument(
+                    "stevensMathLib::ReservoirSampler - cannot merge a sampler into itself");
+            }
+            if (other.capacity_ != capacity_) {
+                throw std::invalid_argument(
+                    "stevensMathLib::ReservoirSampler - cannot merge samplers of different capacity");
+            }
+
+            itemsSeen_ += other.itemsSeen_;
+            slots_.insert(slots_.end(), other.slots_.begin(), other.slots_.end());
+
+            if (slots_.size() < capacity_) {
+                return;
+            }
+
+            std::nth_element(slots_.begin(), slots_.begin() + (capacity_ - 1), slots_.end(),
+                             [](const Slot& a, const Slot& b) { return a.key < b.key; });
+            slots_.resize(capacity_);
+            startSkipping();
+        }
+
+        /**
+         * @brief Returns a copy of the sampled items (in no particular order)
+         */
+        std::vector<T> sample() const
+        {
+            std::vector<T> items;
+            items.reserve(slots_.size());
+            for (const Slot& slot : slots_) {
+                items.push_back(slot.item);
+            }
+            return items;
+        }
+
+        std::size_t size() const { return slots_.size(); }
+        std::size_t capacity() const { return capacity_; }
+        std::uint64_t itemsSeen() const { return itemsSeen_; }
+
+        void clear()
+        {
+            slots_.clear();
+            itemsSeen_ = 0;
+            skipRemaining_ = 0;
+        }
+
+    private:
+        struct Slot
+        {
+            double key;
+            T item;
+
+            // Max-heap on key: the front slot is the next one to be replaced
+            bool operator<(const Slot& other) const { return key < other.key; }
+        };
+
+        void fill(const T& item)
+        {
+            slots_.push_back({detail::uniformOpenUnit(getRandomEngine()), item});
+            if (slots_.size() == capacity_) {
+                startSkipping();
+            }
+        }
+
+        void startSkipping()
+        {
+            std::make_heap(slots_.begin(), slots_.end());
+            drawSkip();
+        }
+
+        /**
+         * The largest retained key W is the acceptance threshold. A new item's
+         * key is uniform, so the gap until one lands below W is geometric.
+         */
+        void drawSkip()
+        {
+            const double threshold = slots_.front().key;
+            const double skip = std::floor(std::log(detail::uniformOpenUnit(getRandomEngine())) /
+                                           std::log1p(-threshold));
+            const double maxSkip = static_cast<double>(std::numeric_limits<std::uint64_t>::max() / 2);
+            skipRemaining_ = static_cast<std::uint64_t>(std::min(skip, maxSkip));
+        }
+
+        void replace(const T& item)
+        {
+            // Conditioned on being accepted, the new key is uniform below the threshold
+            const double threshold = slots_.front().key;
+            std::pop_heap(slots_.begin(), slots_.end());
+            slots_.back() = {threshold * detail::uniformOpenUnit(getRandomEngine()), item};
+            std::push_heap(slots_.begin(), slots_.end());
+            drawSkip();
+        }
+
+        std::size_t capacity_;
+        std::vector<Slot> slots_;
+        std::uint64_t itemsSeen_ = 0;
+        std::uint64_t skipRemaining_ = 0;
+    };
+
+    /**
+     * @brief Weighted random sample without replacement from an unbounded stream
+     *
+     * @tparam T The item type
+     *
+     * Implements Efraimidis and Spirakis' A-ExpJ: each item gets the key
+     * u^(1/weight) and the k largest keys are kept. Exponential jumps skip
+     * over items that cannot enter the reservoir, so random numbers are only
+     * drawn for items that are actually inserted. Keys are kept in log space
+     * to stay accurate for very small and very large weights.
+     *
+     * Randomness comes from getRandomEngine(), so setSeed() makes samples reproducible.
+     */
+    template <typename T>
+    class WeightedReservoirSampler
+    {
+    public:
+        /**
+         * @brief Creates an empty sampler
+         *
+         * @param capacity Number of items to keep (k)
+         *
+         * @throws std::invalid_argument if capacity is zero
+         */
+        explicit WeightedReservoirSampler(std::size_t capacity)
+            : capacity_(capacity)
+        {
+            if (capacity == 0) {
+                throw std::invalid_argument(
+                    "stevensMathLib::WeightedReservoirSampler - capacity must be greater than zero");
+            }
+            slots_.reserve(capacity);
+        }
+
+        /**
+         * @brief Offers one weighted stream item to the sampler
+         *
+         * @param item The item
+         * @param weight Relative selection weight; zero-weight items are never selected
+         *
+         * @throws std::invalid_argument if weight is negative or NaN
+         */
+        void add(const T& item, double weight)
+        {
+            if (!(weight >= 0.0)) {
+                throw std::invalid_argument(
+                    "stevensMathLib::WeightedReservoirSampler - weight must be non-negative");
+            }
+
+            ++itemsSeen_;
+            totalWeight_ += weight;
+            if (weight == 0.0) {
+                return;
+            }
+
+            if (slots_.size() < capacity_) {
+                const double logKey = std::log(detail::uniformOpenUnit(getRandomEngine())) / weight;
+                slots_.push_back({logKey, item});
+                if (slots_.size() == capacity_) {
+                    startJumping();
+                }
+                return;
+            }
+
+            jumpRemaining_ -= weight;
+            if (jumpRemaining_ <= 0.0) {
+                replace(item, weight);
+            }
+        }
+
+        /**
+         * @brief Offers count consecutive weighted items to the sampler
+         *
+         * @throws std::invalid_argument if any weight is negative or NaN
+         */
+        void add(const T* items, const double* weights, std::size_t count)
+        {
+            for (std::size_t i = 0; i < count; ++i) {
+                add(items[i], weights[i]);
+            }
+        }
+
+        /**
+         * @brief Folds in a sampler that saw a disjoint part of the stream
+         *
+         * @throws std::invalid_argument if the capacities differ, or if other is
+         *         this sampler (its stream is not disjoint from itself)
+         */
+        void merge(const WeightedReservoirSampler& other)
+        {
+            if (&other == this) {
+                throw std::invalid_argument(
+                    "stevensMathLib::WeightedReservoirSampler - cannot merge a sampler into itself");
+            }
+            if (other.capacity_ != capacity_) {
+                throw std::invalid_argument(
+                    "stevensMathLib::WeightedReservoirSampler - cannot merge samplers of different capacity");
+            }
+
+            itemsSeen_ += other.itemsSeen_;
+            totalWeight_ += other.totalWeight_;
+            slots_.insert(slots_.end(), other.slots_.begin(), other.slots_.end());
+
+            if (slots_.size() < capacity_) {
+                return;
+            }
+
+            std::nth_element(slots_.begin(), slots_.begin() + (capacity_ - 1), slots_.end(),
+                             [](const Slot& a, const Slot& b) { return a.logKey > b.logKey; });
+            slots_.resize(capacity_);
+            startJumping();
+        }
+
+        /**
+         * @brief Returns a copy of the sampled items (in no particular order)
+         */
+        std::vector<T> sample() const
+        {
+            std::vector<T> items;
+            items.reserve(slots_.size());
+            for (const Slot& slot : slots_) {
+                items.push_back(slot.item);
+            }
+            return items;
+        }
+
+        std::size_t size() const { return slots_.size(); }
+        std::size_t capacity() const { return capacity_; }
+        std::uint64_t itemsSeen() const { return itemsSeen_; }
+        double totalWeight() const { return totalWeight_; }
+
+        void clear()
+        {
+            slots_.clear();
+            itemsSeen_ = 0;
+            totalWeight_ = 0.0;
+            jumpRemaining_ = 0.0;
+        }
+
+    private:
+        struct Slot
+        {
+            double logKey;
+            T item;
+
+            // Min-heap on key: the front slot holds the smallest key
+            bool operator<(const Slot& other) const { return logKey > other.logKey; }
+        };
+
+        void startJumping()
+        {
+            std::make_heap(slots_.begin(), slots_.end());
+            drawJump();
+        }
+
+        // Weight that must pass before some item's key beats the current minimum
+        void drawJump()
+        {
+            const double logThreshold = slots_.front().logKey;
+            jumpRemaining_ = std::log(detail::uniformOpenUnit(getRandomEngine())) / logThreshold;
+        }
+
+        void replace(const T& item, double weight)
+        {
+            // The new key is uniform between threshold^weight and 1 (A-ExpJ step)
+            const double logThreshold = slots_.front().logKey;
+            const double lowerKey = std::exp(weight * logThreshold);
+            const double u = detail::uniformOpenUnit(getRandomEngine());
+            const double logKey = std::log(lowerKey + (1.0 - lowerKey) * u) / weight;
+
+            std::pop_heap(slots_.begin(), slots_.end());
+            slots_.back() = {logKey, item};
+            std::push_heap(slots_.begin(), slots_.end());
+            drawJump();
+        }
+
+        std::size_t capacity_;
+        std::vector<Slot> slots_;
+        std::uint64_t itemsSeen_ = 0;
+        double totalWeight_ = 0.0;
+        double jumpRemaining_ = 0.0;
+    };
+
+    namespace detail
+    {
+        /**
+         * @brief One alias-method draw over raw column arrays
+         *
+         * Shared by AliasTable and the memory-mapped AliasTableView so both
+         * return the same outcome for the same engine state.
+         */
+        template <typename Engine>
+        std::size_t sampleAlias(Engine& engine, const std::uint64_t* thresholds, const std::uint32_t* aliases,
+                                std::uint32_t columnCount)
+        {
+            const std::uint32_t column = boundedRandom(engine, columnCount);
+            const std::uint64_t coin = static_cast<std::uint32_t>(engine());
+            return coin < thresholds[column] ? column : aliases[column];
+        }
+    } // namespace detail
+
+    /**
+     * @brief O(1) sampler for a fixed discrete distribution (Vose's alias method)
+     *
+     * Built once from a list of weights in O(n). Each sample costs one bounded
+     * draw to pick a column and one raw draw to choose between the column and
+     * its alias, independent of how many outcomes there are.
+     */
+    class AliasTable
+    {
+    public:
+        AliasTable() = default;
+
+        /**
+         * @brief Builds the table
+         *
+         * @param weights Relative (unnormalized) weight of each outcome
+         *
+         * @throws std::invalid_argument if weights is empty, has a negative or
+         *         non-finite entry, or sums to zero
+         */
+        explicit AliasTable(const std::vector<double>& weights)
+        {
+            const std::size_t outcomeCount = weights.size();
+            if (outcomeCount == 0 || outcomeCount > std::numeric_limits<std::uint32_t>::max()) {
+                throw std::invalid_argument("stevensMathLib::AliasTable - invalid number of weights");
+            }
+
+            double totalWeight = 0.0;
+            for (const double weight : weights) {
+                if (!(weight >= 0.0) || std::isinf(weight)) {
+                    throw std::invalid_argument(
+                        "stevensMathLib::AliasTable - weights must be finite and non-negative");
+                }
+                totalWeight += weight;
+            }
+            if (totalWeight <= 0.0) {
+                throw std::invalid_argument("stevensMathLib::AliasTable - weights sum to zero");
+            }
+
+            std::vector<double> scaled(outcomeCount);
+            std::vector<std::uint32_t> small;
+            std::vector<std::uint32_t> large;
+            for (std::size_t i = 0; i < outcomeCount; ++i) {
+                scaled[i] = weights[i] * static_cast<double>(outcomeCount) / totalWeight;
+                (scaled[i] < 1.0 ? small : large).push_back(static_cast<std::uint32_t>(i));
+            }
+
+            thresholds_.assign(outcomeCount, fullThreshold);
+            aliases_.resize(outcomeCount);
+            for (std::size_t i = 0; i < outcomeCount; ++i) {
+                aliases_[i] = static_cast<std::uint32_t>(i);
+            }
+
+            while (!small.empty() && !large.empty()) {
+                const std::uint32_t lessLikely = small.back();
+                const std::uint32_t moreLikely = large.back();
+                small.pop_back();
+
+                thresholds_[lessLikely] = toThreshold(scaled[lessLikely]);
+                aliases_[lessLikely] = moreLikely;
+                scaled[moreLikely] -= 1.0 - scaled[lessLikely];
+
+                if (scaled[moreLikely] < 1.0) {
+                    large.pop_back();
+                    small.push_back(moreLikely);
+                }
+            }
+            // Anything left over is 1.0 up to rounding error and keeps fullThreshold
+        }
+
+        /**
+         * @brief Draws an outcome index using the given engine
+         */
+        template <typename Engine>
+        std::size_t sample(Engine& engine) const
+        {
+            return detail::sampleAlias(engine, thresholds_.data(), aliases_.data(),
+                                       static_cast<std::uint32_t>(thresholds_.size()));
+        }
+
+        /**
+         * @brief Draws an outcome index using getRandomEngine()
+         */
+        std::size_t sample() const
+        {
+            return sample(getRandomEngine());
+        }
+
+        std::size_t size() const { return thresholds_.size(); }
+
+        /**
+         * @brief Per-column coin thresholds as 32-bit fixed point (2^32 means always keep the column)
+         */
+        const std::vector<std::uint64_t>& thresholds() const { return thresholds_; }
+
+        /**
+         * @brief Per-column alias outcome, used when the coin fails
+         */
+        const std::vector<std::uint32_t>& aliases() const { return aliases_; }
+
+    private:
+        // Probabilities are stored as 32-bit fixed point so the coin flip is an integer compare
+        static constexpr std::uint64_t fullThreshold = std::uint64_t{1} << 32;
+
+        static std::uint64_t toThreshold(double probability)
+        {
+            return static_cast<std::uint64_t>(std::min(1.0, std::max(0.0, probability)) * 4294967296.0);
+        }
+
+        std::vector<std::uint64_t> thresholds_;
+        std::vector<std::uint32_t> aliases_;
+    };
+} // namespace stevensMathLib
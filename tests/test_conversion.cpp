@@ -6,7 +6,10 @@
 
 #include "../stevensMathLib.h"
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
 #include <limits>
+#include <string>
 
 using namespace stevensMathLib;
 
@@ -16,19 +19,14 @@ class ConversionTest : public ::testing::Test
 protected:
     void SetUp() override
     {
-        // Redirect cerr to suppress warning messages during tests
-        originalCerr = std::cerr.rdbuf();
-        std::cerr.rdbuf(nullptr);
+        // Capture stderr to suppress warning messages during tests
+        testing::internal::CaptureStderr();
     }
 
     void TearDown() override
     {
-        // Restore cerr
-        std::cerr.rdbuf(originalCerr);
+        testing::internal::GetCapturedStderr();
     }
-
-private:
-    std::streambuf* originalCerr;
 };
 
 // Tests for floatToInt
@@ -89,6 +87,15 @@ TEST_F(ConversionTest, FloatToInt_UnderflowReturnsMax)
     EXPECT_EQ(floatToInt(tinyValue), std::numeric_limits<int>::max());
 }
 
+TEST_F(ConversionTest, FloatToInt_OverflowWarnsOnStderr)
+{
+    floatToInt(1e10);
+    const std::string warning = testing::internal::GetCapturedStderr();
+    testing::internal::CaptureStderr();
+
+    EXPECT_NE(warning.find("unsafe conversion of value 1e+10 to int"), std::string::npos);
+}
+
 TEST_F(ConversionTest, FloatToInt_NearIntMax)
 {
     int maxInt = std::numeric_limits<int>::max();
@@ -106,3 +113,53 @@ TEST_F(ConversionTest, FloatToInt_NearIntMin)
     EXPECT_GT(result, minInt);
     EXPECT_LT(result, 0);
 }
+
+// Tests for floatToInteger
+TEST_F(ConversionTest, FloatToInteger_TruncatesLikeStaticCast)
+{
+    EXPECT_EQ(floatToInteger<std::int64_t>(3.99), 3);
+    EXPECT_EQ(floatToInteger<std::int64_t>(-3.99), -3);
+    EXPECT_EQ(floatToInteger<std::uint64_t>(-0.5), 0u);
+    EXPECT_EQ(floatToInteger<std::int64_t>(1e15), 1000000000000000ll);
+    EXPECT_EQ(floatToInteger<std::uint8_t>(255.9f), 255);
+    EXPECT_EQ(floatToInteger<std::int16_t>(-32768.0), -32768);
+}
+
+TEST_F(ConversionTest, FloatToInteger_ExactAt64BitLimits)
+{
+    // double(INT64_MAX) rounds up to 2^63, which is already out of range
+    const double twoTo63 = std::ldexp(1.0, 63);
+    EXPECT_EQ(floatToInteger<std::int64_t>(std::nextafter(twoTo63, 0.0)), 9223372036854774784ll);
+    EXPECT_EQ(floatToInteger<std::int64_t>(-twoTo63), std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(floatToInteger<std::uint64_t>(twoTo63), 9223372036854775808ull);
+
+    const double twoTo64 = std::ldexp(1.0, 64);
+    EXPECT_EQ(floatToInteger<std::uint64_t>(std::nextafter(twoTo64, 0.0)), 18446744073709549568ull);
+}
+
+TEST_F(ConversionTest, FloatToInteger_SaturatesAndWarns)
+{
+    testing::internal::GetCapturedStderr();
+    testing::internal::CaptureStderr();
+
+    EXPECT_EQ(floatToInteger<std::int64_t>(std::ldexp(1.0, 63)), std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ(floatToInteger<std::int64_t>(-1e19), std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(floatToInteger<std::uint64_t>(-1.0), 0u);
+    EXPECT_EQ(floatToInteger<std::uint64_t>(1e20f), std::numeric_limits<std::uint64_t>::max());
+    EXPECT_EQ(floatToInteger<std::int32_t>(std::nan("")), std::numeric_limits<std::int32_t>::max());
+
+    const std::string warning = testing::internal::GetCapturedStderr();
+    EXPECT_NE(warning.find("to a 64-bit integer. Returning max()"), std::string::npos);
+    EXPECT_NE(warning.find("Returning min()"), std::string::npos);
+    testing::internal::CaptureStderr();
+}
+
+TEST_F(ConversionTest, FloatToInteger_LongDoubleKeepsFractionalEdge)
+{
+    // long double can hold 2^63 - 0.5, which truncates to INT64_MAX
+    if (std::numeric_limits<long double>::digits < 64) {
+        GTEST_SKIP() << "long double is no wider than double here";
+    }
+    const long double almost = std::ldexp(1.0L, 63) - 0.5L;
+    EXPECT_EQ(floatToInteger<std::int64_t>(almost), std::numeric_limits<std::int64_t>::max());
+}
@@ -0,0 +1,206 @@
+/**
+ * test_decimal.cpp
+ *
+ * Unit tests for the Decimal fixed-point type in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <limits>
+#include <string>
+
+using namespace stevensMathLib;
+
+// Test fixture for fixed-point decimal tests
+class DecimalTest : public ::testing::Test {};
+
+// Tests for construction and conversion
+TEST_F(DecimalTest, FromFloat_RoundsOnce)
+{
+    EXPECT_EQ(Decimal<2>::fromFloat(3.14159).scaled(), 314);
+    EXPECT_EQ(Decimal<2>::fromFloat(19.999).scaled(), 2000);
+    EXPECT_EQ(Decimal<1>::fromFloat(-2.47).scaled(), -25);
+    EXPECT_EQ(Decimal<0>::fromFloat(7.5).scaled(), 8);
+}
+
+TEST_F(DecimalTest, FromFloat_RoundingModes)
+{
+    EXPECT_EQ(Decimal<0>::fromFloat(2.5, RoundingMode::HalfAwayFromZero).scaled(), 3);
+    EXPECT_EQ(Decimal<0>::fromFloat(2.5, RoundingMode::HalfEven).scaled(), 2);
+    EXPECT_EQ(Decimal<0>::fromFloat(3.5, RoundingMode::HalfEven).scaled(), 4);
+    EXPECT_EQ(Decimal<0>::fromFloat(-2.7, RoundingMode::TowardZero).scaled(), -2);
+    EXPECT_EQ(Decimal<0>::fromFloat(-2.2, RoundingMode::Floor).scaled(), -3);
+    EXPECT_EQ(Decimal<0>::fromFloat(2.2, RoundingMode::Ceiling).scaled(), 3);
+}
+
+TEST_F(DecimalTest, FromFloat_MatchesRound)
+{
+    for (float value : {3.14159f, -7.126f, 0.25f, 123.456f}) {
+        EXPECT_FLOAT_EQ(Decimal<2>::fromFloat(value).toFloat(), round(value, 2));
+    }
+}
+
+TEST_F(DecimalTest, FromFloat_ThrowsOutOfRange)
+{
+    EXPECT_THROW(Decimal<2>::fromFloat(1e30), std::out_of_range);
+    EXPECT_THROW(Decimal<2>::fromFloat(std::numeric_limits<double>::quiet_NaN()), std::out_of_range);
+    EXPECT_THROW(Decimal<2>::fromFloat(std::numeric_limits<double>::infinity()), std::out_of_range);
+}
+
+TEST_F(DecimalTest, WholeNumberConstructor)
+{
+    EXPECT_EQ(Decimal<3>(42).scaled(), 42000);
+    EXPECT_DOUBLE_EQ(Decimal<3>(-5).toDouble(), -5.0);
+    EXPECT_THROW(Decimal<18>(100), std::out_of_range);
+}
+
+// Tests for arithmetic
+TEST_F(DecimalTest, AddSubtract_AreExact)
+{
+    Decimal<2> total;
+    const Decimal<2> cent = Decimal<2>::fromScaled(1);
+    for (int i = 0; i < 1000; ++i) {
+        total += cent;
+    }
+    EXPECT_EQ(total, Decimal<2>(10));
+    EXPECT_EQ(total - Decimal<2>(10), Decimal<2>());
+    EXPECT_EQ((-total).scaled(), -1000);
+}
+
+TEST_F(DecimalTest, Multiply_RoundsResult)
+{
+    const Decimal<2> price = Decimal<2>::fromFloat(19.99);
+    EXPECT_EQ((price * Decimal<2>(3)).scaled(), 5997);
+
+    const Decimal<2> rate = Decimal<2>::fromFloat(0.15);
+    EXPECT_EQ((price * rate).scaled(), 300);  // 2.9985 -> 3.00
+    EXPECT_EQ(Decimal<2>::multiply(price, rate, RoundingMode::TowardZero).scaled(), 299);
+}
+
+TEST_F(DecimalTest, Divide_RoundsResult)
+{
+    const Decimal<2> ten(10);
+    const Decimal<2> three(3);
+    EXPECT_EQ((ten / three).scaled(), 333);
+    EXPECT_EQ(Decimal<2>::divide(ten, three, RoundingMode::Ceiling).scaled(), 334);
+    EXPECT_EQ((-ten / three).scaled(), -333);
+    EXPECT_EQ(Decimal<2>::divide(-ten, three, RoundingMode::Floor).scaled(), -334);
+}
+
+TEST_F(DecimalTest, Divide_ThrowsOnZero)
+{
+    EXPECT_THROW(Decimal<2>(1) / Decimal<2>(), std::domain_error);
+}
+
+TEST_F(DecimalTest, Multiply_ThrowsOnOverflow)
+{
+    const Decimal<0> large(std::numeric_limits<std::int64_t>::max() / 2);
+    EXPECT_THROW(large * Decimal<0>(3), std::overflow_error);
+}
+
+TEST_F(DecimalTest, AddSubtract_ThrowOnOverflow)
+{
+    const Decimal<2> largest = Decimal<2>::fromScaled(std::numeric_limits<std::int64_t>::max());
+    const Decimal<2> smallest = Decimal<2>::fromScaled(std::numeric_limits<std::int64_t>::min());
+    const Decimal<2> cent = Decimal<2>::fromScaled(1);
+
+    EXPECT_THROW(largest + cent, std::overflow_error);
+    EXPECT_THROW(smallest - cent, std::overflow_error);
+    EXPECT_THROW(smallest + (-cent), std::overflow_error);
+    EXPECT_THROW(Decimal<2>() - smallest, std::overflow_error);
+    EXPECT_THROW(-smallest, std::overflow_error);
+
+    // Right up to the limits is still fine
+    EXPECT_EQ((largest - cent + cent).scaled(), std::numeric_limits<std::int64_t>::max());
+    EXPECT_EQ((smallest + largest).scaled(), -1);
+    EXPECT_EQ((-largest).scaled(), -std::numeric_limits<std::int64_t>::max());
+
+    Decimal<2> total = largest;
+    EXPECT_THROW(total += cent, std::overflow_error);
+    EXPECT_EQ(total, largest);
+}
+
+TEST_F(DecimalTest, Divide_ThrowsOnMinByMinusOne)
+{
+    const Decimal<0> smallest = Decimal<0>::fromScaled(std::numeric_limits<std::int64_t>::min());
+    EXPECT_THROW(smallest / Decimal<0>(-1), std::overflow_error);
+    EXPECT_EQ((smallest / Decimal<0>(1)).scaled(), std::numeric_limits<std::int64_t>::min());
+}
+
+TEST_F(DecimalTest, Divide_RoundsNearTheLimits)
+{
+    // A remainder above 2^62 used to be doubled before comparing
+    const std::int64_t largest = std::numeric_limits<std::int64_t>::max();
+    const Decimal<0> numerator = Decimal<0>::fromScaled(largest - 1);
+    const Decimal<0> denominator = Decimal<0>::fromScaled(largest);
+    EXPECT_EQ(Decimal<0>::divide(numerator, denominator).scaled(), 1);
+    EXPECT_EQ(Decimal<0>::divide(-numerator, denominator).scaled(), -1);
+    EXPECT_EQ(Decimal<0>::divide(numerator, denominator, RoundingMode::TowardZero).scaled(), 0);
+
+    const Decimal<0> smallest = Decimal<0>::fromScaled(std::numeric_limits<std::int64_t>::min());
+    EXPECT_EQ(Decimal<0>::divide(numerator, smallest).scaled(), -1);
+    EXPECT_EQ(Decimal<0>::divide(Decimal<0>(1), smallest).scaled(), 0);
+}
+
+TEST_F(DecimalTest, ProductOverflowCheck)
+{
+    const std::int64_t largest = std::numeric_limits<std::int64_t>::max();
+    const std::int64_t smallest = std::numeric_limits<std::int64_t>::min();
+
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(0, smallest));
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(largest, 1));
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(smallest, 1));
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(largest, -1));
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(3037000499, 3037000499));
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(-3037000499, 3037000499));
+    EXPECT_TRUE(stevensMathLib::detail::productOverflowsInt64(smallest, -1));
+    EXPECT_TRUE(stevensMathLib::detail::productOverflowsInt64(-1, smallest));
+    EXPECT_TRUE(stevensMathLib::detail::productOverflowsInt64(3037000500, 3037000500));
+    EXPECT_TRUE(stevensMathLib::detail::productOverflowsInt64(-3037000500, -3037000500));
+    EXPECT_TRUE(stevensMathLib::detail::productOverflowsInt64(largest / 2 + 1, 2));
+    EXPECT_TRUE(stevensMathLib::detail::productOverflowsInt64(smallest / 2 - 1, 2));
+    EXPECT_FALSE(stevensMathLib::detail::productOverflowsInt64(smallest / 2, 2));
+}
+
+TEST_F(DecimalTest, Rescale)
+{
+    const Decimal<3> precise = Decimal<3>::fromScaled(3145);
+    EXPECT_EQ(precise.rescale<1>().scaled(), 31);
+    EXPECT_EQ(precise.rescale<2>(RoundingMode::HalfEven).scaled(), 314);
+    EXPECT_EQ(precise.rescale<2>().scaled(), 315);
+    EXPECT_EQ(precise.rescale<5>().scaled(), 314500);
+}
+
+TEST_F(DecimalTest, Comparisons)
+{
+    EXPECT_LT(Decimal<2>::fromFloat(1.01), Decimal<2>::fromFloat(1.02));
+    EXPECT_GE(Decimal<2>(1), Decimal<2>::fromFloat(0.999));
+    EXPECT_NE(Decimal<2>(1), Decimal<2>());
+}
+
+TEST_F(DecimalTest, IsWholeNumber)
+{
+    EXPECT_TRUE(isWholeNumber(Decimal<2>(5)));
+    EXPECT_TRUE(isWholeNumber(Decimal<2>::fromFloat(-3.0)));
+    EXPECT_FALSE(isWholeNumber(Decimal<2>::fromFloat(3.1)));
+}
+
+// Tests for formatting
+TEST_F(DecimalTest, ToString)
+{
+    EXPECT_EQ(Decimal<2>::fromFloat(3.14159).toString(), "3.14");
+    EXPECT_EQ(Decimal<2>::fromFloat(-0.05).toString(), "-0.05");
+    EXPECT_EQ(Decimal<3>(7).toString(), "7.000");
+    EXPECT_EQ(Decimal<0>(-42).toString(), "-42");
+    EXPECT_EQ(Decimal<2>().toString(), "0.00");
+    EXPECT_EQ(Decimal<0>::fromScaled(std::numeric_limits<std::int64_t>::min()).toString(),
+              "-9223372036854775808");
+}
+
+TEST_F(DecimalTest, ToChars_ReportsShortBuffer)
+{
+    char buffer[4];
+    EXPECT_EQ(Decimal<2>::fromFloat(3.14).toChars(buffer, sizeof(buffer)), 4u);
+    EXPECT_EQ(std::string(buffer, 4), "3.14");
+    EXPECT_EQ(Decimal<2>::fromFloat(31.4).toChars(buffer, sizeof(buffer)), 0u);
+}
@@ -0,0 +1,294 @@
+/**
+ * test_dice.cpp
+ *
+ * Unit tests for dice expressions and alias-table sampling in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <numeric>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for dice tests
+class DiceTest : public ::testing::Test
+{
+protected:
+    static constexpr int sampleSize = 100000;
+
+    void SetUp() override
+    {
+        setSeed(31337);
+    }
+
+    static double sampleMean(const DiceRoll& dice)
+    {
+        double total = 0.0;
+        for (int i = 0; i < sampleSize; ++i) {
+            total += dice.roll();
+        }
+        return total / sampleSize;
+    }
+};
+
+// Tests for AliasTable
+TEST_F(DiceTest, AliasTable_FollowsWeights)
+{
+    const AliasTable table({1.0, 2.0, 0.0, 5.0});
+    std::vector<int> counts(4, 0);
+    for (int i = 0; i < sampleSize; ++i) {
+        ++counts[table.sample()];
+    }
+
+    EXPECT_EQ(table.size(), 4u);
+    EXPECT_EQ(counts[2], 0);
+    EXPECT_NEAR(counts[0] / static_cast<double>(sampleSize), 0.125, 0.01);
+    EXPECT_NEAR(counts[1] / static_cast<double>(sampleSize), 0.25, 0.01);
+    EXPECT_NEAR(counts[3] / static_cast<double>(sampleSize), 0.625, 0.01);
+}
+
+TEST_F(DiceTest, AliasTable_InvalidWeights)
+{
+    EXPECT_THROW(AliasTable(std::vector<double>{}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({0.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(AliasTable({1.0, -1.0}), std::invalid_argument);
+}
+
+// Tests for parsing
+TEST_F(DiceTest, Parse_RangeOfSimpleExpressions)
+{
+    const DiceRoll threeD6Plus2("3d6+2");
+    EXPECT_EQ(threeD6Plus2.minimum(), 5);
+    EXPECT_EQ(threeD6Plus2.maximum(), 20);
+
+    const DiceRoll d20("d20");
+    EXPECT_EQ(d20.minimum(), 1);
+    EXPECT_EQ(d20.maximum(), 20);
+
+    const DiceRoll mixed("1D8 + 1d6 - 2");
+    EXPECT_EQ(mixed.minimum(), 0);
+    EXPECT_EQ(mixed.maximum(), 12);
+
+    const DiceRoll negative("-1d4 + 10");
+    EXPECT_EQ(negative.minimum(), 6);
+    EXPECT_EQ(negative.maximum(), 9);
+
+    const DiceRoll constant("7");
+    EXPECT_EQ(constant.roll(), 7);
+}
+
+TEST_F(DiceTest, Parse_KeepAndDropSyntaxesAgree)
+{
+    const DiceRoll words("4d6 drop lowest");
+    for (const char* equivalent : {"4d6dl1", "4d6d1", "4d6kh3", "4d6k3", "4d6 keep highest 3"}) {
+        const DiceRoll other(equivalent);
+        EXPECT_EQ(other.probabilities(), words.probabilities()) << equivalent;
+    }
+
+    const DiceRoll disadvantage("2d20kl1");
+    EXPECT_EQ(DiceRoll("2d20 drop highest").probabilities(), disadvantage.probabilities());
+}
+
+TEST_F(DiceTest, Parse_InvalidExpressionsThrow)
+{
+    for (const char* bad : {"", "d", "3d", "3d6+", "3x6", "0d6", "3d0", "4d6kh5", "4d6dl4",
+                            "4d6 drop sideways", "99999999999d6"}) {
+        EXPECT_THROW(DiceRoll{bad}, std::invalid_argument) << bad;
+    }
+}
+
+// Tests for exact distributions
+TEST_F(DiceTest, ExactDistribution_3d6)
+{
+    const DiceRoll dice("3d6");
+    ASSERT_TRUE(dice.hasExactDistribution());
+    EXPECT_EQ(dice.probabilities().size(), 16u);
+    EXPECT_NEAR(dice.probabilityOf(3), 1.0 / 216.0, 1e-12);
+    EXPECT_NEAR(dice.probabilityOf(10), 27.0 / 216.0, 1e-12);
+    EXPECT_NEAR(dice.probabilityOf(18), 1.0 / 216.0, 1e-12);
+    EXPECT_EQ(dice.probabilityOf(19), 0.0);
+    EXPECT_NEAR(std::accumulate(dice.probabilities().begin(), dice.probabilities().end(), 0.0), 1.0, 1e-12);
+    EXPECT_DOUBLE_EQ(dice.expectedValue(), 10.5);
+}
+
+TEST_F(DiceTest, ExactDistribution_4d6DropLowest)
+{
+    const DiceRoll dice("4d6 drop lowest");
+    ASSERT_TRUE(dice.hasExactDistribution());
+    EXPECT_NEAR(dice.probabilityOf(18), 21.0 / 1296.0, 1e-12);
+    EXPECT_NEAR(dice.probabilityOf(3), 1.0 / 1296.0, 1e-12);
+    EXPECT_NEAR(dice.expectedValue(), 15869.0 / 1296.0, 1e-9);
+
+    double mean = 0.0;
+    for (std::size_t i = 0; i < dice.probabilities().size(); ++i) {
+        mean += (dice.minimum() + static_cast<int>(i)) * dice.probabilities()[i];
+    }
+    EXPECT_NEAR(mean, dice.expectedValue(), 1e-9);
+}
+
+TEST_F(DiceTest, ExactDistribution_Advantage)
+{
+    const DiceRoll advantage("2d20kh1");
+    EXPECT_NEAR(advantage.expectedValue(), 13.825, 1e-9);
+    EXPECT_NEAR(advantage.probabilityOf(20), 39.0 / 400.0, 1e-12);
+
+    const DiceRoll disadvantage("2d20kl1");
+    EXPECT_NEAR(disadvantage.expectedValue(), 7.175, 1e-9);
+    EXPECT_NEAR(disadvantage.probabilityOf(1), 39.0 / 400.0, 1e-12);
+}
+
+TEST_F(DiceTest, ExactDistribution_ExpectedValueMatchesTable)
+{
+    for (const char* expression : {"10d10kh5", "6d8kl2", "5d12dh1 + 2d4"}) {
+        const DiceRoll dice(expression);
+        ASSERT_TRUE(dice.hasExactDistribution()) << expression;
+
+        double mean = 0.0;
+        for (std::size_t i = 0; i < dice.probabilities().size(); ++i) {
+            mean += (dice.minimum() + static_cast<int>(i)) * dice.probabilities()[i];
+        }
+        EXPECT_NEAR(mean, dice.expectedValue(), 1e-9) << expression;
+    }
+}
+
+TEST_F(DiceTest, Roll_MatchesExpectedValue)
+{
+    const DiceRoll dice("3d6+2");
+    EXPECT_NEAR(sampleMean(dice), dice.expectedValue(), 0.05);
+
+    for (int i = 0; i < 1000; ++i) {
+        const int result = dice.roll();
+        EXPECT_GE(result, 5);
+        EXPECT_LE(result, 20);
+    }
+}
+
+// Tests for large expressions without exact tables
+TEST_F(DiceTest, LargeExpression_FallsBackToDirectRolls)
+{
+    const DiceRoll dice("100d100kh50");
+    EXPECT_FALSE(dice.hasExactDistribution());
+    EXPECT_TRUE(dice.probabilities().empty());
+    EXPECT_THROW(dice.probabilityOf(100), std::logic_error);
+
+    // Standard error of the sample mean is roughly 0.35 here
+    EXPECT_NEAR(sampleMean(dice), dice.expectedValue(), 2.0);
+}
+
+TEST_F(DiceTest, LargeKeepExpression_ExpectedValueIsCheap)
+{
+    const auto start = std::chrono::steady_clock::now();
+    const DiceRoll upperHalf("100000d1000kh50000");
+    const DiceRoll lowerHalf("100000d1000kl50000");
+    const DiceRoll allButLowest("1000000d2000kh999999");
+    const double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Used to sum every binomial term up to keep: seconds to minutes
+    EXPECT_LT(elapsed, 1.0);
+
+    // Both halves together are every die
+    EXPECT_NEAR(upperHalf.expectedValue() + lowerHalf.expectedValue(), 100000 * 500.5, 1e-3);
+    // The lowest of a million d2000 is 1 all but surely
+    EXPECT_NEAR(allButLowest.expectedValue(), 1000000 * 1000.5 - 1.0, 1e-3);
+}
+
+TEST_F(DiceTest, FewDiceWithManySides_RollInTimeOfTheDice)
+{
+    const DiceRoll highest("2d1000000kh1");
+    const DiceRoll lowest("5d100000kl2");
+    ASSERT_FALSE(highest.hasExactDistribution());
+    ASSERT_FALSE(lowest.hasExactDistribution());
+
+    const int rolls = 20000;
+    double highestTotal = 0.0;
+    double lowestTotal = 0.0;
+    const auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < rolls; ++i) {
+        const int high = highest.roll();
+        const int low = lowest.roll();
+        ASSERT_GE(high, highest.minimum());
+        ASSERT_LE(high, highest.maximum());
+        ASSERT_GE(low, lowest.minimum());
+        ASSERT_LE(low, lowest.maximum());
+        highestTotal += high;
+        lowestTotal += low;
+    }
+    const double elapsed =
+        std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+
+    // Used to clear a counter per face on every roll: about 20 s here
+    EXPECT_LT(elapsed, 1.0);
+
+    // Standard errors of the means are about 1700 and 240
+    EXPECT_NEAR(highestTotal / rolls, highest.expectedValue(), 8000.0);
+    EXPECT_NEAR(lowestTotal / rolls, lowest.expectedValue(), 1200.0);
+}
+
+TEST_F(DiceTest, LargePlainExpression_ExpectedValue)
+{
+    const DiceRoll dice("100000d6");
+    EXPECT_FALSE(dice.hasExactDistribution());
+    EXPECT_DOUBLE_EQ(dice.expectedValue(), 350000.0);
+    EXPECT_EQ(dice.minimum(), 100000);
+    EXPECT_EQ(dice.maximum(), 600000);
+}
+
+TEST_F(DiceTest, LargePlainExpression_ExactTableHasNoNegativeProbabilities)
+{
+    // The sliding-window sum used to leave tiny negative tail entries here
+    for (const char* expression : {"50d20", "1000d6", "200d300"}) {
+        const DiceRoll dice(expression);
+        ASSERT_TRUE(dice.hasExactDistribution()) << expression;
+        double total = 0.0;
+        for (double probability : dice.probabilities()) {
+            ASSERT_GE(probability, 0.0) << expression;
+            total += probability;
+        }
+        EXPECT_NEAR(total, 1.0, 1e-9) << expression;
+        EXPECT_GE(dice.roll(), dice.minimum()) << expression;
+    }
+}
+
+TEST_F(DiceTest, LargePlainExpression_SkipsCostlyTable)
+{
+    EXPECT_FALSE(DiceRoll("3000d20").hasExactDistribution());
+
+    // 10000d6 has under 2^16 totals, but tabulating it would take about a second
+    const DiceRoll dice("10000d6");
+    EXPECT_FALSE(dice.hasExactDistribution());
+
+    // Standard deviation of one roll is about 171, so about 17 for the mean of 100
+    double total = 0.0;
+    for (int i = 0; i < 100; ++i) {
+        total += dice.roll();
+    }
+    EXPECT_NEAR(total / 100.0, 35000.0, 100.0);
+}
+
+TEST_F(DiceTest, RollBatch_WithinRange)
+{
+    const DiceRoll dice("2d8-1");
+    std::vector<int> results(1000);
+    dice.rollBatch(results.data(), results.size());
+    for (int result : results) {
+        EXPECT_GE(result, 1);
+        EXPECT_LE(result, 15);
+    }
+}
+
+TEST_F(DiceTest, SetSeed_MakesRollsReproducible)
+{
+    const DiceRoll dice("4d6 drop lowest");
+    std::vector<int> first(100);
+    std::vector<int> second(100);
+
+    setSeed(5);
+    dice.rollBatch(first.data(), first.size());
+    setSeed(5);
+    dice.rollBatch(second.data(), second.size());
+
+    EXPECT_EQ(first, second);
+}
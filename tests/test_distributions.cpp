@@ -0,0 +1,249 @@
+/**
+ * test_distributions.cpp
+ *
+ * Unit tests for the binomial, Poisson and geometric samplers in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for discrete distribution tests
+class DistributionsTest : public ::testing::Test
+{
+protected:
+    static constexpr int samples = 20000;
+
+    void SetUp() override
+    {
+        setSeed(4242);
+    }
+
+    struct Moments
+    {
+        double mean;
+        double variance;
+    };
+
+    template <typename Draw>
+    static Moments moments(Draw draw)
+    {
+        double sum = 0.0;
+        double sumOfSquares = 0.0;
+        for (int i = 0; i < samples; ++i) {
+            const double value = static_cast<double>(draw());
+            sum += value;
+            sumOfSquares += value * value;
+        }
+        const double mean = sum / samples;
+        return {mean, sumOfSquares / samples - mean * mean};
+    }
+
+    // Allows five standard errors of slack on the sample mean
+    static double meanTolerance(double variance)
+    {
+        return 5.0 * std::sqrt(variance / samples);
+    }
+};
+
+// Binomial tests
+TEST_F(DistributionsTest, BinomialSmallMeanUsesInversionAndMatchesMoments)
+{
+    BinomialSampler sampler(50, 0.2);
+    auto result = moments([&]() { return sampler.sample(); });
+
+    EXPECT_NEAR(result.mean, 10.0, meanTolerance(8.0));
+    EXPECT_NEAR(result.variance, 8.0, 0.5);
+}
+
+TEST_F(DistributionsTest, BinomialLargeMeanMatchesMoments)
+{
+    BinomialSampler sampler(100000, 0.3);
+    auto result = moments([&]() { return sampler.sample(); });
+
+    EXPECT_NEAR(result.mean, 30000.0, meanTolerance(21000.0));
+    EXPECT_NEAR(result.variance, 21000.0, 1500.0);
+}
+
+TEST_F(DistributionsTest, StirlingCorrectionMatchesLogGamma)
+{
+    const double halfLogTwoPi = 0.5 * std::log(2.0 * 3.14159265358979323846);
+    for (double x : {10.0, 25.5, 100.0, 12345.0}) {
+        const double stirling = (x - 0.5) * std::log(x) - x + halfLogTwoPi;
+        EXPECT_NEAR(detail::stirlingCorrection(x), std::lgamma(x) - stirling, 1e-9 * std::lgamma(x) + 1e-12) << x;
+    }
+    EXPECT_NEAR(detail::stirlingCorrection(1000.0) * 12000.0, 1.0, 1e-6);
+}
+
+TEST_F(DistributionsTest, BinomialSqueezePathMatchesMoments)
+{
+    // n p q = 250: draws 21 to 124 away from the mode go through the squeeze
+    // and the Stirling-based exact test rather than the explicit ratio
+    BinomialSampler sampler(1000, 0.5);
+    double sum = 0.0;
+    double sumOfSquares = 0.0;
+    const int draws = 400000;
+    for (int i = 0; i < draws; ++i) {
+        const double value = sampler.sample();
+        sum += value;
+        sumOfSquares += value * value;
+    }
+    const double mean = sum / draws;
+    const double variance = sumOfSquares / draws - mean * mean;
+
+    EXPECT_NEAR(mean, 500.0, 5.0 * std::sqrt(250.0 / draws));
+    EXPECT_NEAR(variance, 250.0, 5.0);
+}
+
+TEST_F(DistributionsTest, BinomialHighProbabilityMirrorsCorrectly)
+{
+    BinomialSampler inversion(40, 0.9);
+    BinomialSampler btpe(1000, 0.75);
+
+    EXPECT_NEAR(moments([&]() { return inversion.sample(); }).mean, 36.0, meanTolerance(3.6));
+    EXPECT_NEAR(moments([&]() { return btpe.sample(); }).mean, 750.0, meanTolerance(187.5));
+}
+
+TEST_F(DistributionsTest, BinomialStaysWithinSupport)
+{
+    for (int trials : {1, 7, 64, 500, 10000}) {
+        for (double probability : {0.01, 0.5, 0.99}) {
+            BinomialSampler sampler(trials, probability);
+            for (int i = 0; i < 500; ++i) {
+                int value = sampler.sample();
+                EXPECT_GE(value, 0);
+                EXPECT_LE(value, trials);
+            }
+        }
+    }
+}
+
+TEST_F(DistributionsTest, BinomialMatchesExactProbabilitiesForSmallCase)
+{
+    // Binomial(4, 0.5) has probabilities 1/16, 4/16, 6/16, 4/16, 1/16
+    std::vector<int> counts(5, 0);
+    for (int i = 0; i < samples; ++i) {
+        ++counts[randomBinomial(4, 0.5)];
+    }
+
+    const double expected[] = {1.0, 4.0, 6.0, 4.0, 1.0};
+    for (int k = 0; k < 5; ++k) {
+        EXPECT_NEAR(counts[k] / static_cast<double>(samples), expected[k] / 16.0, 0.015);
+    }
+}
+
+TEST_F(DistributionsTest, BinomialDegenerateParameters)
+{
+    EXPECT_EQ(randomBinomial(0, 0.5), 0);
+    EXPECT_EQ(randomBinomial(100, 0.0), 0);
+    EXPECT_EQ(randomBinomial(100, 1.0), 100);
+}
+
+TEST_F(DistributionsTest, BinomialRejectsInvalidParameters)
+{
+    EXPECT_THROW(BinomialSampler(-1, 0.5), std::invalid_argument);
+    EXPECT_THROW(BinomialSampler(10, -0.1), std::invalid_argument);
+    EXPECT_THROW(BinomialSampler(10, 1.5), std::invalid_argument);
+    EXPECT_THROW(randomBinomial(10, std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+}
+
+// Poisson tests
+TEST_F(DistributionsTest, PoissonSmallMeanMatchesMoments)
+{
+    auto result = moments([]() { return randomPoisson(3.5); });
+
+    EXPECT_NEAR(result.mean, 3.5, meanTolerance(3.5));
+    EXPECT_NEAR(result.variance, 3.5, 0.3);
+}
+
+TEST_F(DistributionsTest, PoissonLargeMeanMatchesMoments)
+{
+    PoissonSampler sampler(2500.0);
+    auto result = moments([&]() { return sampler.sample(); });
+
+    EXPECT_NEAR(result.mean, 2500.0, meanTolerance(2500.0));
+    EXPECT_NEAR(result.variance, 2500.0, 200.0);
+}
+
+TEST_F(DistributionsTest, PoissonAroundThresholdIsNonNegative)
+{
+    for (double mean : {9.99, 10.0, 10.01, 30.0}) {
+        PoissonSampler sampler(mean);
+        auto result = moments([&]() {
+            auto value = sampler.sample();
+            EXPECT_GE(value, 0);
+            return value;
+        });
+        EXPECT_NEAR(result.mean, mean, meanTolerance(mean));
+    }
+}
+
+TEST_F(DistributionsTest, PoissonZeroMeanAndInvalidMeans)
+{
+    EXPECT_EQ(randomPoisson(0.0), 0);
+    EXPECT_THROW(PoissonSampler(-1.0), std::invalid_argument);
+    EXPECT_THROW(PoissonSampler(std::numeric_limits<double>::infinity()), std::invalid_argument);
+    EXPECT_THROW(randomPoisson(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+}
+
+// Geometric tests
+TEST_F(DistributionsTest, GeometricMatchesMoments)
+{
+    // Failures before the first success: mean (1 - p) / p, variance (1 - p) / p^2
+    auto result = moments([]() { return randomGeometric(0.25); });
+
+    EXPECT_NEAR(result.mean, 3.0, meanTolerance(12.0));
+    EXPECT_NEAR(result.variance, 12.0, 1.5);
+}
+
+TEST_F(DistributionsTest, GeometricHandlesTinyAndCertainProbabilities)
+{
+    GeometricSampler rare(1e-6);
+    auto result = moments([&]() { return rare.sample(); });
+    EXPECT_NEAR(result.mean / 1e6, 1.0, 0.05);
+
+    EXPECT_EQ(randomGeometric(1.0), 0);
+    EXPECT_THROW(GeometricSampler(0.0), std::invalid_argument);
+    EXPECT_THROW(GeometricSampler(1.5), std::invalid_argument);
+}
+
+// Reproducibility tests
+TEST_F(DistributionsTest, SeedReproducesAllSamplers)
+{
+    auto drawAll = []() {
+        std::vector<std::int64_t> values;
+        for (int i = 0; i < 50; ++i) {
+            values.push_back(randomBinomial(20, 0.3));
+            values.push_back(randomBinomial(5000, 0.4));
+            values.push_back(randomPoisson(4.0));
+            values.push_back(randomPoisson(400.0));
+            values.push_back(randomGeometric(0.1));
+        }
+        return values;
+    };
+
+    setSeed(99);
+    auto first = drawAll();
+    setSeed(99);
+    auto second = drawAll();
+
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(DistributionsTest, SamplersAcceptCustomEngines)
+{
+    std::mt19937 engineA(5);
+    std::mt19937 engineB(5);
+    BinomialSampler binomial(1000, 0.5);
+    PoissonSampler poisson(50.0);
+
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(binomial(engineA), binomial(engineB));
+        EXPECT_EQ(poisson(engineA), poisson(engineB));
+    }
+}
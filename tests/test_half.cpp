@@ -0,0 +1,275 @@
+/**
+ * test_half.cpp
+ *
+ * Unit tests for the Float16 and BFloat16 conversions in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for half-precision tests
+class HalfTest : public ::testing::Test
+{
+protected:
+    static std::uint16_t half(float value, HalfRounding rounding = HalfRounding::NearestEven)
+    {
+        return toFloat16(value, rounding).bits;
+    }
+
+    static std::uint16_t brain(float value, HalfRounding rounding = HalfRounding::NearestEven)
+    {
+        return toBFloat16(value, rounding).bits;
+    }
+
+    // Ordinary values, boundaries, ties, subnormals and specials, plus a
+    // sweep of bit patterns across the whole float range
+    static std::vector<float> sampleFloats()
+    {
+        std::vector<float> values = {0.0f, -0.0f, 1.0f, -1.0f, 0.1f, 3.14159f, 65504.0f, 65519.99f,
+                                     65520.0f, 65536.0f, 1e10f, -1e10f, std::ldexp(1.0f, -14),
+                                     std::ldexp(1.0f, -24), std::ldexp(1.0f, -25), std::ldexp(3.0f, -26),
+                                     std::ldexp(1.0f, -30), std::numeric_limits<float>::denorm_min(),
+                                     std::numeric_limits<float>::max(), std::numeric_limits<float>::infinity(),
+                                     -std::numeric_limits<float>::infinity(), 1.0009765625f, 1.00048828125f,
+                                     1.00146484375f, 2049.0f, 2051.0f};
+        for (std::uint64_t bits = 0; bits <= 0xFFFFFFFFull; bits += 65521) {
+            float value;
+            const std::uint32_t word = static_cast<std::uint32_t>(bits);
+            std::memcpy(&value, &word, sizeof(value));
+            if (!std::isnan(value)) {
+                values.push_back(value);
+            }
+        }
+        // Odd length so the vector tails run too
+        if (values.size() % 2 == 0) {
+            values.push_back(0.5f);
+        }
+        return values;
+    }
+};
+
+// Tests for Float16 scalar conversions
+TEST_F(HalfTest, Float16_KnownEncodings)
+{
+    EXPECT_EQ(half(0.0f), 0x0000);
+    EXPECT_EQ(half(-0.0f), 0x8000);
+    EXPECT_EQ(half(1.0f), 0x3C00);
+    EXPECT_EQ(half(-2.0f), 0xC000);
+    EXPECT_EQ(half(65504.0f), 0x7BFF);
+    EXPECT_EQ(half(std::ldexp(1.0f, -14)), 0x0400);
+    EXPECT_EQ(half(std::ldexp(1.0f, -24)), 0x0001);
+    EXPECT_EQ(half(std::numeric_limits<float>::infinity()), 0x7C00);
+    EXPECT_TRUE(std::isnan(toFloat(toFloat16(std::nanf("")))));
+}
+
+TEST_F(HalfTest, Float16_NearestEvenTiesAndOverflow)
+{
+    // 1 + 2^-11 sits exactly between 1 and 1 + 2^-10: ties to even (1.0)
+    EXPECT_EQ(half(1.00048828125f), 0x3C00);
+    // 1 + 3 * 2^-11 ties between odd 0x3C01 and even 0x3C02
+    EXPECT_EQ(half(1.00146484375f), 0x3C02);
+    // 2^-25 ties between 0 and the smallest subnormal
+    EXPECT_EQ(half(std::ldexp(1.0f, -25)), 0x0000);
+    EXPECT_EQ(half(std::ldexp(3.0f, -26)), 0x0001);
+    // 65520 is halfway to the next power of two and rounds to infinity
+    EXPECT_EQ(half(65519.99f), 0x7BFF);
+    EXPECT_EQ(half(65520.0f), 0x7C00);
+    EXPECT_EQ(half(-1e10f), 0xFC00);
+}
+
+TEST_F(HalfTest, Float16_TowardZeroTruncatesAndSaturates)
+{
+    EXPECT_EQ(half(1.0009f, HalfRounding::TowardZero), 0x3C00);
+    EXPECT_EQ(half(-1.0009f, HalfRounding::TowardZero), 0xBC00);
+    EXPECT_EQ(half(65519.99f, HalfRounding::TowardZero), 0x7BFF);
+    EXPECT_EQ(half(1e10f, HalfRounding::TowardZero), 0x7BFF);
+    EXPECT_EQ(half(std::numeric_limits<float>::infinity(), HalfRounding::TowardZero), 0x7C00);
+}
+
+TEST_F(HalfTest, Float16_EveryValueRoundTrips)
+{
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        const Float16 value{static_cast<std::uint16_t>(bits)};
+        const float widened = toFloat(value);
+        if (std::isnan(widened)) {
+            EXPECT_TRUE(std::isnan(toFloat(toFloat16(widened)))) << bits;
+            continue;
+        }
+        ASSERT_EQ(toFloat16(widened).bits, bits) << bits;
+        ASSERT_EQ(toFloat16(widened, HalfRounding::TowardZero).bits, bits) << bits;
+        ASSERT_EQ(toFloat16(widened, HalfRounding::Stochastic).bits, bits) << bits;
+    }
+}
+
+// Tests for BFloat16 scalar conversions
+TEST_F(HalfTest, BFloat16_KnownEncodings)
+{
+    EXPECT_EQ(brain(1.0f), 0x3F80);
+    EXPECT_EQ(brain(-2.0f), 0xC000);
+    EXPECT_EQ(brain(3.14159f), 0x4049);
+    EXPECT_EQ(brain(3.14159f, HalfRounding::TowardZero), 0x4049);
+    EXPECT_EQ(brain(3.152f), 0x404A);
+    EXPECT_EQ(brain(3.152f, HalfRounding::TowardZero), 0x4049);
+    EXPECT_EQ(brain(std::numeric_limits<float>::max()), 0x7F80);
+    EXPECT_EQ(brain(std::numeric_limits<float>::max(), HalfRounding::TowardZero), 0x7F7F);
+    EXPECT_EQ(brain(std::numeric_limits<float>::denorm_min()), 0x0000);
+    EXPECT_EQ(toFloat(BFloat16{0x0001}), std::ldexp(1.0f, -133));
+
+    // A NaN whose payload sits only in the low 16 bits stays NaN
+    float lowPayloadNaN;
+    const std::uint32_t nanBits = 0x7F800001u;
+    std::memcpy(&lowPayloadNaN, &nanBits, sizeof(lowPayloadNaN));
+    EXPECT_TRUE(std::isnan(toFloat(toBFloat16(lowPayloadNaN))));
+    EXPECT_TRUE(std::isnan(toFloat(toBFloat16(lowPayloadNaN, HalfRounding::TowardZero))));
+}
+
+TEST_F(HalfTest, BFloat16_EveryValueRoundTrips)
+{
+    for (std::uint32_t bits = 0; bits <= 0xFFFF; ++bits) {
+        const float widened = toFloat(BFloat16{static_cast<std::uint16_t>(bits)});
+        if (std::isnan(widened)) {
+            continue;
+        }
+        ASSERT_EQ(toBFloat16(widened).bits, bits) << bits;
+        ASSERT_EQ(toBFloat16(widened, HalfRounding::Stochastic).bits, bits) << bits;
+    }
+}
+
+// Tests for stochastic rounding
+TEST_F(HalfTest, Stochastic_IsUnbiasedBetweenNeighbours)
+{
+    setSeed(11);
+    // A quarter of the way from 1.0 to the next Float16 (1 + 2^-10)
+    const float value = 1.0f + std::ldexp(1.0f, -12);
+    const std::size_t count = 40000;
+    std::vector<float> values(count, value);
+    std::vector<Float16> halves(count);
+    toFloat16Batch(values.data(), halves.data(), count, HalfRounding::Stochastic);
+
+    double sum = 0.0;
+    int roundedUp = 0;
+    for (const Float16 h : halves) {
+        ASSERT_TRUE(h.bits == 0x3C00 || h.bits == 0x3C01) << h.bits;
+        roundedUp += h.bits == 0x3C01;
+        sum += toFloat(h);
+    }
+    EXPECT_NEAR(roundedUp, count / 4, 600);
+    EXPECT_NEAR(sum / count, value, 1e-5);
+
+    std::vector<BFloat16> brains(count);
+    toBFloat16Batch(values.data(), brains.data(), count, HalfRounding::Stochastic);
+    // The same offset is only 1/32 of a bfloat16 ulp
+    int brainsUp = 0;
+    for (const BFloat16 b : brains) {
+        ASSERT_TRUE(b.bits == 0x3F80 || b.bits == 0x3F81) << b.bits;
+        brainsUp += b.bits == 0x3F81;
+    }
+    EXPECT_NEAR(brainsUp, count / 32, 200);
+}
+
+TEST_F(HalfTest, Stochastic_ReproducibleAfterSetSeed)
+{
+    const std::vector<float> values = sampleFloats();
+    std::vector<Float16> first(values.size());
+    std::vector<Float16> second(values.size());
+
+    setSeed(3);
+    toFloat16Batch(values.data(), first.data(), values.size(), HalfRounding::Stochastic);
+    const Float16 single = toFloat16(1.1f, HalfRounding::Stochastic);
+    setSeed(3);
+    toFloat16Batch(values.data(), second.data(), values.size(), HalfRounding::Stochastic);
+    EXPECT_EQ(toFloat16(1.1f, HalfRounding::Stochastic).bits, single.bits);
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(first[i].bits, second[i].bits) << i;
+        // Always one of the two neighbours
+        // Always one of the two neighbours (magnitude truncated or one step up)
+        const std::uint16_t down = toFloat16(values[i], HalfRounding::TowardZero).bits;
+        const std::uint16_t up = static_cast<std::uint16_t>(down + ((down & 0x7FFF) == 0x7C00 ? 0 : 1));
+        ASSERT_TRUE(first[i].bits == down || first[i].bits == up) << i << " " << values[i];
+    }
+}
+
+// Tests for the batch kernels
+TEST_F(HalfTest, Batch_MatchesScalarOnEveryKernel)
+{
+    const char* kernel = activeHalfKernel();
+    EXPECT_TRUE(std::strcmp(kernel, "avx512") == 0 || std::strcmp(kernel, "f16c") == 0
+                || std::strcmp(kernel, "scalar") == 0);
+
+    const std::vector<float> values = sampleFloats();
+    std::vector<Float16> halves(values.size());
+    std::vector<BFloat16> brains(values.size());
+    std::vector<float> widened(values.size());
+
+    for (HalfRounding rounding : {HalfRounding::NearestEven, HalfRounding::TowardZero}) {
+        toFloat16Batch(values.data(), halves.data(), values.size(), rounding);
+        toBFloat16Batch(values.data(), brains.data(), values.size(), rounding);
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            ASSERT_EQ(halves[i].bits, toFloat16(values[i], rounding).bits) << kernel << " " << values[i];
+            ASSERT_EQ(brains[i].bits, toBFloat16(values[i], rounding).bits) << kernel << " " << values[i];
+        }
+
+        toFloatBatch(halves.data(), widened.data(), halves.size());
+        for (std::size_t i = 0; i < halves.size(); ++i) {
+            const float expected = toFloat(halves[i]);
+            ASSERT_EQ(std::memcmp(&widened[i], &expected, sizeof(float)), 0) << i;
+        }
+        toFloatBatch(brains.data(), widened.data(), brains.size());
+        for (std::size_t i = 0; i < brains.size(); ++i) {
+            ASSERT_EQ(widened[i], toFloat(brains[i])) << i;
+        }
+    }
+}
+
+TEST_F(HalfTest, Kernels_AllAvailableKernelsAgree)
+{
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+    const std::vector<float> values = sampleFloats();
+    std::vector<Float16> scalar(values.size());
+    std::vector<Float16> vector(values.size());
+    std::vector<float> scalarWide(values.size());
+    std::vector<float> vectorWide(values.size());
+
+    const auto compare = [&](auto narrow, auto widen) {
+        for (HalfRounding rounding : {HalfRounding::NearestEven, HalfRounding::TowardZero}) {
+            detail::floatToHalfScalar(values.data(), scalar.data(), values.size(), rounding, 0);
+            narrow(values.data(), vector.data(), values.size(), rounding, 0);
+            ASSERT_EQ(std::memcmp(scalar.data(), vector.data(), values.size() * sizeof(Float16)), 0);
+        }
+        detail::halfToFloatScalar(scalar.data(), scalarWide.data(), scalar.size());
+        widen(scalar.data(), vectorWide.data(), scalar.size());
+        ASSERT_EQ(std::memcmp(scalarWide.data(), vectorWide.data(), scalar.size() * sizeof(float)), 0);
+    };
+
+    if (__builtin_cpu_supports("avx2") && __builtin_cpu_supports("f16c")) {
+        compare(detail::floatToHalfF16c, detail::halfToFloatF16c);
+    }
+    if (__builtin_cpu_supports("avx512f") && __builtin_cpu_supports("avx512bw")) {
+        compare(detail::floatToHalfAvx512, detail::halfToFloatAvx512);
+    }
+#else
+    GTEST_SKIP() << "no x86 dispatch on this target";
+#endif
+}
+
+// Tests for round and isWholeNumber on half values
+TEST_F(HalfTest, RoundAndIsWholeNumber)
+{
+    EXPECT_TRUE(isWholeNumber(toFloat16(42.0f)));
+    EXPECT_FALSE(isWholeNumber(toFloat16(42.5f)));
+    EXPECT_TRUE(isWholeNumber(toBFloat16(1024.0f)));
+    EXPECT_FALSE(isWholeNumber(toBFloat16(1.5f)));
+
+    EXPECT_EQ(toFloat(round(toFloat16(3.14159f), 2)), 3.140625f);
+    EXPECT_EQ(round(toFloat16(3.14159f), 2).bits, toFloat16(3.14f).bits);
+    EXPECT_EQ(toFloat(round(toFloat16(2.75f), 0)), 3.0f);
+    EXPECT_EQ(round(toBFloat16(3.14159f), 1).bits, toBFloat16(3.1f).bits);
+}
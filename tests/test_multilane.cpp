@@ -0,0 +1,190 @@
+/**
+ * test_multilane.cpp
+ *
+ * Unit tests for MultiLaneEngine in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for the multi-lane engine
+class MultiLaneTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        setSeed(1357);
+    }
+
+    // Plain one-lane xoshiro256++ seeded the way MultiLaneEngine documents
+    struct ReferenceXoshiro
+    {
+        std::uint64_t s[4];
+
+        std::uint64_t next()
+        {
+            const std::uint64_t sum = s[0] + s[3];
+            const std::uint64_t result = ((sum << 23) | (sum >> 41)) + s[0];
+            const std::uint64_t t = s[1] << 17;
+            s[2] ^= s[0];
+            s[3] ^= s[1];
+            s[1] ^= s[2];
+            s[0] ^= s[3];
+            s[2] ^= t;
+            s[3] = (s[3] << 45) | (s[3] >> 19);
+            return result;
+        }
+    };
+
+    template <std::size_t Lanes>
+    static std::vector<ReferenceXoshiro> referenceLanes(std::uint64_t seed)
+    {
+        std::vector<ReferenceXoshiro> lanes(Lanes);
+        for (auto& lane : lanes) {
+            for (auto& word : lane.s) {
+                word = detail::splitMix64(seed);
+            }
+        }
+        return lanes;
+    }
+
+    template <std::size_t Lanes>
+    static void expectMatchesReference()
+    {
+        MultiLaneEngine<Lanes> engine(42);
+        auto reference = referenceLanes<Lanes>(42);
+
+        std::vector<std::uint64_t> values(Lanes * 50 + 3);
+        engine.fill(values.data(), values.size());
+
+        for (std::size_t i = 0; i < values.size(); ++i) {
+            EXPECT_EQ(values[i], reference[i % Lanes].next()) << "index " << i;
+        }
+    }
+};
+
+TEST_F(MultiLaneTest, ActiveKernelIsKnown)
+{
+    const std::string kernel = MultiLaneEngine<8>::activeKernel();
+    EXPECT_TRUE(kernel == "avx512" || kernel == "avx2" || kernel == "scalar");
+}
+
+TEST_F(MultiLaneTest, MatchesScalarReferenceForEveryLaneCount)
+{
+    expectMatchesReference<1>();
+    expectMatchesReference<4>();
+    expectMatchesReference<8>();
+    expectMatchesReference<16>();
+}
+
+TEST_F(MultiLaneTest, OperatorAndFillShareOneSequence)
+{
+    MultiLaneEngine<8> singles(7);
+    MultiLaneEngine<8> mixed(7);
+
+    std::vector<std::uint64_t> expected(100);
+    for (auto& value : expected) {
+        value = singles();
+    }
+
+    std::vector<std::uint64_t> actual(100);
+    actual[0] = mixed();
+    actual[1] = mixed();
+    actual[2] = mixed();
+    mixed.fill(actual.data() + 3, 60);
+    for (std::size_t i = 63; i < actual.size(); ++i) {
+        actual[i] = mixed();
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(MultiLaneTest, DefaultConstructorIsReproducibleUnderSetSeed)
+{
+    setSeed(99);
+    MultiLaneEngine<16> first;
+    setSeed(99);
+    MultiLaneEngine<16> second;
+
+    for (int i = 0; i < 1000; ++i) {
+        EXPECT_EQ(first(), second());
+    }
+
+    // The seed is the first engine output in the high half, the second in the low half
+    setSeed(99);
+    const std::uint64_t high = getRandomEngine()();
+    const std::uint64_t low = getRandomEngine()();
+    MultiLaneEngine<16> explicitSeed((high << 32) | low);
+    setSeed(99);
+    MultiLaneEngine<16> third;
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_EQ(third(), explicitSeed());
+    }
+}
+
+TEST_F(MultiLaneTest, FillFloatsStaysInRange)
+{
+    MultiLaneEngine<8> engine;
+    std::vector<float> values(10001);
+    engine.fillFloats(values.data(), values.size(), -2.0f, 3.0f);
+
+    double sum = 0.0;
+    for (float value : values) {
+        EXPECT_GE(value, -2.0f);
+        EXPECT_LE(value, 3.0f);
+        sum += value;
+    }
+    EXPECT_NEAR(sum / values.size(), 0.5, 0.05);
+}
+
+TEST_F(MultiLaneTest, FillIntsIsUniform)
+{
+    MultiLaneEngine<8> engine;
+    std::vector<int> values(60000);
+    engine.fillInts(values.data(), values.size(), 10, 16);
+
+    std::vector<int> counts(6, 0);
+    for (int value : values) {
+        ASSERT_GE(value, 10);
+        ASSERT_LT(value, 16);
+        ++counts[value - 10];
+    }
+    for (int count : counts) {
+        EXPECT_NEAR(count, 10000, 500);
+    }
+}
+
+TEST_F(MultiLaneTest, FillIntsHandlesFullAndEmptyRanges)
+{
+    MultiLaneEngine<4> engine;
+    std::vector<int> values(1000);
+
+    engine.fillInts(values.data(), values.size(), 5, 5);
+    for (int value : values) {
+        EXPECT_EQ(value, 5);
+    }
+
+    engine.fillInts(values.data(), values.size(), std::numeric_limits<int>::min(), std::numeric_limits<int>::max());
+    std::set<int> unique(values.begin(), values.end());
+    EXPECT_GT(unique.size(), 990u);
+}
+
+TEST_F(MultiLaneTest, DrivesStandardDistributions)
+{
+    MultiLaneEngine<8> engine;
+    std::uniform_int_distribution<int> distribution(1, 6);
+
+    for (int i = 0; i < 100; ++i) {
+        int roll = distribution(engine);
+        EXPECT_GE(roll, 1);
+        EXPECT_LE(roll, 6);
+    }
+}
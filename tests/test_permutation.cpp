@@ -0,0 +1,175 @@
+/**
+ * test_permutation.cpp
+ *
+ * Unit tests for RandomPermutation in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for random permutation tests
+class PermutationTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        setSeed(2468);
+    }
+
+    static bool isBijection(const RandomPermutation& permutation)
+    {
+        std::vector<bool> seen(permutation.size(), false);
+        for (std::uint64_t i = 0; i < permutation.size(); ++i) {
+            const std::uint64_t value = permutation.permute(i);
+            if (value >= permutation.size() || seen[value]) {
+                return false;
+            }
+            seen[value] = true;
+        }
+        return true;
+    }
+};
+
+TEST_F(PermutationTest, IsBijectionForManySizes)
+{
+    for (std::uint64_t size : {1ull, 2ull, 3ull, 5ull, 16ull, 17ull, 1000ull, 4097ull, 65536ull, 100003ull}) {
+        RandomPermutation permutation(size);
+        EXPECT_TRUE(isBijection(permutation)) << "size " << size;
+    }
+}
+
+TEST_F(PermutationTest, InverseUndoesPermute)
+{
+    RandomPermutation permutation(12345);
+    for (std::uint64_t i = 0; i < permutation.size(); ++i) {
+        EXPECT_EQ(permutation.inverse(permutation.permute(i)), i);
+    }
+}
+
+TEST_F(PermutationTest, HandlesHugeRanges)
+{
+    const std::uint64_t size = 1ull << 40;
+    RandomPermutation permutation(size);
+
+    for (std::uint64_t i : std::vector<std::uint64_t>{0, 1, 123456789, size / 2, size - 1}) {
+        const std::uint64_t value = permutation.permute(i);
+        EXPECT_LT(value, size);
+        EXPECT_EQ(permutation.inverse(value), i);
+    }
+}
+
+TEST_F(PermutationTest, HandlesFullWidthRange)
+{
+    const std::uint64_t size = std::numeric_limits<std::uint64_t>::max();
+    RandomPermutation permutation(size);
+
+    for (std::uint64_t i : std::vector<std::uint64_t>{0, 42, size - 1}) {
+        const std::uint64_t value = permutation.permute(i);
+        EXPECT_LT(value, size);
+        EXPECT_EQ(permutation.inverse(value), i);
+    }
+}
+
+TEST_F(PermutationTest, BatchMatchesScalar)
+{
+    RandomPermutation permutation(1000);
+    std::vector<std::uint64_t> indices(1000);
+    std::iota(indices.begin(), indices.end(), 0);
+    std::vector<std::uint64_t> results(indices.size());
+
+    permutation.permute(indices.data(), results.data(), indices.size());
+
+    for (std::size_t i = 0; i < indices.size(); ++i) {
+        EXPECT_EQ(results[i], permutation.permute(indices[i]));
+    }
+}
+
+TEST_F(PermutationTest, BatchSupportsInPlaceAndPartialBlocks)
+{
+    RandomPermutation permutation(77);
+    std::vector<std::uint64_t> values = {3, 76, 0, 41, 9};
+    const std::vector<std::uint64_t> original = values;
+
+    permutation.permute(values.data(), values.data(), values.size());
+
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        EXPECT_EQ(values[i], permutation.permute(original[i]));
+    }
+}
+
+TEST_F(PermutationTest, IterationVisitsEveryValueOnce)
+{
+    RandomPermutation permutation(500);
+    std::vector<int> counts(500, 0);
+    std::size_t visited = 0;
+
+    for (std::uint64_t value : permutation) {
+        ++counts[value];
+        ++visited;
+    }
+
+    EXPECT_EQ(visited, 500u);
+    for (int count : counts) {
+        EXPECT_EQ(count, 1);
+    }
+}
+
+TEST_F(PermutationTest, ActuallyShuffles)
+{
+    RandomPermutation permutation(10000);
+    int fixedPoints = 0;
+    for (std::uint64_t i = 0; i < permutation.size(); ++i) {
+        fixedPoints += permutation.permute(i) == i;
+    }
+
+    // A random permutation has one fixed point on average
+    EXPECT_LT(fixedPoints, 10);
+}
+
+TEST_F(PermutationTest, SeedReproducesPermutation)
+{
+    setSeed(5);
+    RandomPermutation first(1ull << 30);
+    setSeed(5);
+    RandomPermutation second(1ull << 30);
+    RandomPermutation third(1ull << 30);
+
+    int differences = 0;
+    for (std::uint64_t i = 0; i < 100; ++i) {
+        EXPECT_EQ(first.permute(i), second.permute(i));
+        differences += first.permute(i) != third.permute(i);
+    }
+    EXPECT_GT(differences, 90);
+}
+
+TEST_F(PermutationTest, AcceptsCustomEngine)
+{
+    std::mt19937 engineA(11);
+    std::mt19937 engineB(11);
+    RandomPermutation first(999, engineA);
+    RandomPermutation second(999, engineB);
+
+    for (std::uint64_t i = 0; i < 999; ++i) {
+        EXPECT_EQ(first.permute(i), second.permute(i));
+    }
+}
+
+TEST_F(PermutationTest, RejectsInvalidInput)
+{
+    EXPECT_THROW(RandomPermutation(0), std::invalid_argument);
+
+    RandomPermutation permutation(10);
+    EXPECT_THROW(permutation.permute(10), std::out_of_range);
+    EXPECT_THROW(permutation.inverse(10), std::out_of_range);
+
+    std::uint64_t index = 10;
+    std::uint64_t result = 0;
+    EXPECT_THROW(permutation.permute(&index, &result, 1), std::out_of_range);
+}
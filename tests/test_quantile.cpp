@@ -0,0 +1,276 @@
+/**
+ * test_quantile.cpp
+ *
+ * Unit tests for the QuantileSketch streaming quantile estimator in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <random>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for quantile sketch tests
+class QuantileSketchTest : public ::testing::Test
+{
+protected:
+    static constexpr int streamSize = 100000;
+
+    void SetUp() override
+    {
+        setSeed(12345);
+    }
+
+    // Exact normalized rank of value within a sorted 1..n stream
+    static double exactRank(double value, int n)
+    {
+        return std::clamp(value / n, 0.0, 1.0);
+    }
+
+    // Hand-built version 1 serialization, for feeding deserialize() bad contents
+    static std::vector<std::uint8_t> serializedLevels(std::uint64_t count,
+                                                      const std::vector<std::vector<double>>& levels)
+    {
+        std::vector<std::uint8_t> bytes = {'K', 'L', 'L', 1, 200, 0,
+                                           static_cast<std::uint8_t>(levels.size())};
+        const auto append = [&bytes](std::uint64_t value, int byteCount) {
+            for (int byte = 0; byte < byteCount; ++byte) {
+                bytes.push_back(static_cast<std::uint8_t>(value >> (8 * byte)));
+            }
+        };
+        const auto bitsOf = [](double value) {
+            std::uint64_t bits = 0;
+            std::memcpy(&bits, &value, sizeof(bits));
+            return bits;
+        };
+
+        append(count, 8);
+        append(bitsOf(0.0), 8);
+        append(bitsOf(100.0), 8);
+        for (const std::vector<double>& level : levels) {
+            append(level.size(), 4);
+            for (const double item : level) {
+                append(bitsOf(item), 8);
+            }
+        }
+        return bytes;
+    }
+};
+
+TEST_F(QuantileSketchTest, EmptySketch_ReturnsNaN)
+{
+    QuantileSketch sketch;
+    EXPECT_TRUE(sketch.empty());
+    EXPECT_EQ(sketch.count(), 0u);
+    EXPECT_TRUE(std::isnan(sketch.quantile(0.5)));
+    EXPECT_TRUE(std::isnan(sketch.rank(1.0)));
+    EXPECT_TRUE(std::isnan(sketch.min()));
+    EXPECT_TRUE(std::isnan(sketch.max()));
+}
+
+TEST_F(QuantileSketchTest, SmallStream_IsExact)
+{
+    QuantileSketch sketch;
+    for (int i = 100; i >= 1; --i) {
+        sketch.insert(i);
+    }
+
+    EXPECT_EQ(sketch.count(), 100u);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.0), 1.0);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.5), 50.0);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.99), 99.0);
+    EXPECT_DOUBLE_EQ(sketch.quantile(1.0), 100.0);
+    EXPECT_DOUBLE_EQ(sketch.rank(25.0), 0.25);
+}
+
+TEST_F(QuantileSketchTest, LargeStream_WithinRankError)
+{
+    QuantileSketch sketch;
+    std::vector<double> values;
+    for (int i = 1; i <= streamSize; ++i) {
+        values.push_back(i);
+    }
+    std::shuffle(values.begin(), values.end(), getRandomEngine());
+    sketch.insert(values.begin(), values.end());
+
+    EXPECT_EQ(sketch.count(), static_cast<std::uint64_t>(streamSize));
+    EXPECT_LT(sketch.retainedItems(), 1000u);
+    EXPECT_DOUBLE_EQ(sketch.min(), 1.0);
+    EXPECT_DOUBLE_EQ(sketch.max(), streamSize);
+
+    const double tolerance = sketch.normalizedRankError();
+    for (double fraction : {0.01, 0.1, 0.5, 0.9, 0.99}) {
+        const double estimate = sketch.quantile(fraction);
+        EXPECT_NEAR(exactRank(estimate, streamSize), fraction, tolerance) << "fraction " << fraction;
+    }
+}
+
+TEST_F(QuantileSketchTest, Quantiles_MatchesSingleQueries)
+{
+    QuantileSketch sketch;
+    for (int i = 0; i < streamSize; ++i) {
+        sketch.insert(randomFloat(0.0f, 1000.0f));
+    }
+
+    const std::vector<double> fractions = {0.25, 0.5, 0.75};
+    const std::vector<double> batch = sketch.quantiles(fractions);
+    ASSERT_EQ(batch.size(), fractions.size());
+    for (std::size_t i = 0; i < fractions.size(); ++i) {
+        EXPECT_DOUBLE_EQ(batch[i], sketch.quantile(fractions[i]));
+    }
+}
+
+TEST_F(QuantileSketchTest, Merge_CoversBothStreams)
+{
+    QuantileSketch lower;
+    QuantileSketch upper;
+    for (int i = 1; i <= streamSize / 2; ++i) {
+        lower.insert(i);
+        upper.insert(i + streamSize / 2);
+    }
+
+    lower.merge(upper);
+
+    EXPECT_EQ(lower.count(), static_cast<std::uint64_t>(streamSize));
+    EXPECT_DOUBLE_EQ(lower.min(), 1.0);
+    EXPECT_DOUBLE_EQ(lower.max(), streamSize);
+    EXPECT_NEAR(exactRank(lower.quantile(0.5), streamSize), 0.5, lower.normalizedRankError());
+    EXPECT_NEAR(exactRank(lower.quantile(0.9), streamSize), 0.9, lower.normalizedRankError());
+}
+
+TEST_F(QuantileSketchTest, Merge_IntoEmptySketch)
+{
+    QuantileSketch empty;
+    QuantileSketch filled;
+    for (int i = 1; i <= 10; ++i) {
+        filled.insert(i);
+    }
+
+    empty.merge(filled);
+
+    EXPECT_EQ(empty.count(), 10u);
+    EXPECT_DOUBLE_EQ(empty.min(), 1.0);
+    EXPECT_DOUBLE_EQ(empty.max(), 10.0);
+}
+
+TEST_F(QuantileSketchTest, Merge_IntoItselfCountsValuesTwice)
+{
+    QuantileSketch sketch(32);
+    for (int i = 1; i <= streamSize; ++i) {
+        sketch.insert(i);
+    }
+
+    sketch.merge(sketch);
+
+    EXPECT_EQ(sketch.count(), static_cast<std::uint64_t>(2 * streamSize));
+    EXPECT_DOUBLE_EQ(sketch.min(), 1.0);
+    EXPECT_DOUBLE_EQ(sketch.max(), streamSize);
+    EXPECT_NEAR(exactRank(sketch.quantile(0.5), streamSize), 0.5, sketch.normalizedRankError());
+    EXPECT_EQ(QuantileSketch::deserialize(sketch.serialize()).count(), sketch.count());
+}
+
+TEST_F(QuantileSketchTest, Compaction_LeavesGlobalEngineAlone)
+{
+    QuantileSketch sketch(16);
+    std::mt19937 expected = getRandomEngine();
+
+    for (int i = 0; i < streamSize; ++i) {
+        sketch.insert(i);
+    }
+
+    EXPECT_EQ(getRandomEngine(), expected);
+}
+
+TEST_F(QuantileSketchTest, Serialize_RoundTrips)
+{
+    QuantileSketch sketch(64);
+    for (int i = 0; i < streamSize; ++i) {
+        sketch.insert(randomFloat(-50.0f, 50.0f));
+    }
+
+    const std::vector<std::uint8_t> bytes = sketch.serialize();
+    const QuantileSketch restored = QuantileSketch::deserialize(bytes);
+
+    EXPECT_EQ(restored.k(), sketch.k());
+    EXPECT_EQ(restored.count(), sketch.count());
+    EXPECT_EQ(restored.retainedItems(), sketch.retainedItems());
+    EXPECT_DOUBLE_EQ(restored.min(), sketch.min());
+    EXPECT_DOUBLE_EQ(restored.max(), sketch.max());
+    EXPECT_DOUBLE_EQ(restored.quantile(0.5), sketch.quantile(0.5));
+    EXPECT_EQ(restored.serialize(), bytes);
+}
+
+TEST_F(QuantileSketchTest, Deserialize_ThrowsOnMalformedInput)
+{
+    QuantileSketch sketch;
+    sketch.insert(1.0);
+    std::vector<std::uint8_t> bytes = sketch.serialize();
+
+    std::vector<std::uint8_t> truncated(bytes.begin(), bytes.end() - 1);
+    EXPECT_THROW(QuantileSketch::deserialize(truncated), std::invalid_argument);
+
+    bytes[0] = 'X';
+    EXPECT_THROW(QuantileSketch::deserialize(bytes), std::invalid_argument);
+}
+
+TEST_F(QuantileSketchTest, Deserialize_ThrowsOnInconsistentContents)
+{
+    const QuantileSketch valid = QuantileSketch::deserialize(
+        serializedLevels(7, {{5.0, 1.0, 3.0}, {2.0, 4.0}}));
+    EXPECT_EQ(valid.count(), 7u);
+    EXPECT_DOUBLE_EQ(valid.rank(3.0), 4.0 / 7.0);
+
+    // Weight 1 << 64 would be undefined in rank()
+    std::vector<std::vector<double>> tooDeep(64);
+    tooDeep.back().push_back(1.0);
+    EXPECT_THROW(QuantileSketch::deserialize(serializedLevels(0, tooDeep)),
+                 std::invalid_argument);
+
+    EXPECT_THROW(QuantileSketch::deserialize(serializedLevels(6, {{5.0, 1.0, 3.0}, {2.0, 4.0}})),
+                 std::invalid_argument);
+    EXPECT_THROW(QuantileSketch::deserialize(serializedLevels(0, {{}, {}, {1.0}})),
+                 std::invalid_argument);
+    EXPECT_THROW(QuantileSketch::deserialize(serializedLevels(7, {{5.0, 1.0, 3.0}, {4.0, 2.0}})),
+                 std::invalid_argument);
+    EXPECT_THROW(QuantileSketch::deserialize(
+                     serializedLevels(2, {{1.0, std::numeric_limits<double>::quiet_NaN()}})),
+                 std::invalid_argument);
+
+    // Level sizes whose weights overflow a uint64_t must not wrap around to the count
+    std::vector<std::vector<double>> overflowing(63);
+    overflowing[62] = {1.0, 2.0, 3.0, 4.0};
+    EXPECT_THROW(QuantileSketch::deserialize(serializedLevels(0, overflowing)),
+                 std::invalid_argument);
+}
+
+TEST_F(QuantileSketchTest, WithRankError_MeetsTarget)
+{
+    const QuantileSketch sketch = QuantileSketch::withRankError(0.01);
+    EXPECT_LE(sketch.normalizedRankError(), 0.01);
+    EXPECT_GT(QuantileSketch::rankErrorForK(sketch.k() - 1), 0.01);
+}
+
+TEST_F(QuantileSketchTest, InvalidArguments_Throw)
+{
+    EXPECT_THROW(QuantileSketch(4), std::invalid_argument);
+    EXPECT_THROW(QuantileSketch::withRankError(0.0), std::invalid_argument);
+
+    QuantileSketch sketch;
+    sketch.insert(1.0);
+    EXPECT_THROW(sketch.quantile(1.5), std::invalid_argument);
+    EXPECT_THROW(sketch.quantile(-0.1), std::invalid_argument);
+}
+
+TEST_F(QuantileSketchTest, Insert_IgnoresNaN)
+{
+    QuantileSketch sketch;
+    sketch.insert(std::numeric_limits<double>::quiet_NaN());
+    sketch.insert(2.0);
+    EXPECT_EQ(sketch.count(), 1u);
+    EXPECT_DOUBLE_EQ(sketch.quantile(0.5), 2.0);
+}
@@ -6,6 +6,9 @@
 
 #include "../stevensMathLib.h"
 #include <gtest/gtest.h>
+#include <cmath>
+#include <cstdint>
+#include <limits>
 #include <set>
 #include <vector>
 
@@ -206,3 +209,226 @@ TEST_F(RandomTest, GetRandomEngine_ProducesNumbers)
     // Just verify it produces values (they should be different most of the time)
     EXPECT_TRUE(value1 != value2 || value1 == value2); // Always true, just exercises the function
 }
+
+// Golden-vector tests: these sequences must never change between compilers,
+// standard libraries or releases. Update them only for a deliberate, documented
+// change to the distribution algorithms.
+TEST_F(RandomTest, GoldenVector_RandomInt)
+{
+    const std::vector<int> expected = {92, 89, 31, 13, 18, 3, 20, 82, 56, 53};
+
+    setSeed(12345);
+    std::vector<int> actual;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        actual.push_back(randomInt(0, 100));
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomTest, GoldenVector_RandomIntWideRange)
+{
+    const std::vector<int> expected = {1788848259, -607878119, -448243564, -880721511, 703175078, 786634107};
+
+    setSeed(12345);
+    std::vector<int> actual;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        actual.push_back(randomInt(-1000000000, 2000000000));
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomTest, GoldenVector_RandomFloat)
+{
+    const std::vector<float> expected = {0.588014483f, 0.757153332f, 0.69910872f, 0.738747239f,
+                                         0.188151956f, 0.595115066f, 0.0438085198f, 0.893047333f};
+
+    setSeed(2024);
+    for (float value : expected) {
+        EXPECT_EQ(randomFloat(), value);
+    }
+}
+
+TEST_F(RandomTest, GoldenVector_RandomFloatCustomRange)
+{
+    const std::vector<float> expected = {8.80144882f, 25.7153339f, 19.9108715f, 23.8747234f,
+                                         -31.1848049f, 9.51150703f, -45.6191483f, 39.3047333f};
+
+    setSeed(2024);
+    for (float value : expected) {
+        EXPECT_EQ(randomFloat(-50.0f, 50.0f), value);
+    }
+}
+
+TEST_F(RandomTest, GoldenVector_RandomIntNotInBlacklist)
+{
+    const std::vector<int> expected = {0, 7, 4, 9, 7, 4, 9, 5};
+
+    setSeed(7);
+    std::vector<int> actual;
+    for (std::size_t i = 0; i < expected.size(); ++i) {
+        actual.push_back(randomIntNotInBlacklist({1, 2, 3}, 0, 10));
+    }
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomTest, RandomFloat_FollowsDocumentedAlgorithm)
+{
+    std::mt19937 reference(99);
+    setSeed(99);
+
+    for (int i = 0; i < sampleSize; ++i) {
+        const double unit = static_cast<double>(reference() >> 8) / 16777216.0;
+        EXPECT_EQ(randomFloat(), static_cast<float>(unit));
+    }
+}
+
+TEST_F(RandomTest, RandomInt_UsesFullRangeUniformly)
+{
+    setSeed(31337);
+    std::vector<int> counts(6, 0);
+    for (int i = 0; i < 60000; ++i) {
+        ++counts[randomInt(0, 6)];
+    }
+
+    for (int count : counts) {
+        EXPECT_NEAR(count, 10000, 500);
+    }
+}
+
+// Tests for randomBool and randomBernoulli
+TEST_F(RandomTest, RandomBool_IsFair)
+{
+    setSeed(404);
+    int trues = 0;
+    for (int i = 0; i < 100000; ++i) {
+        trues += randomBool();
+    }
+    EXPECT_NEAR(trues, 50000, 800);
+}
+
+TEST_F(RandomTest, RandomBool_UsesOneEngineWordPer32Calls)
+{
+    setSeed(405);
+    const std::uint32_t word = getRandomEngine()();
+
+    setSeed(405);
+    for (int bit = 0; bit < 32; ++bit) {
+        EXPECT_EQ(randomBool(), ((word >> bit) & 1u) != 0);
+    }
+}
+
+TEST_F(RandomTest, RandomBool_SetSeedDiscardsCachedBits)
+{
+    setSeed(406);
+    std::vector<bool> first;
+    for (int i = 0; i < 10; ++i) {
+        first.push_back(randomBool());
+    }
+
+    // Leave 22 bits cached, then reseed: the sequence must restart
+    setSeed(406);
+    std::vector<bool> second;
+    for (int i = 0; i < 10; ++i) {
+        second.push_back(randomBool());
+    }
+
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(RandomTest, RandomBernoulli_MatchesProbability)
+{
+    setSeed(407);
+    for (double probability : {0.01, 0.1, 0.3, 0.5, 0.77, 0.999}) {
+        int successes = 0;
+        for (int i = 0; i < 100000; ++i) {
+            successes += randomBernoulli(probability);
+        }
+        const double tolerance = 5.0 * std::sqrt(100000 * probability * (1.0 - probability));
+        EXPECT_NEAR(successes, 100000 * probability, tolerance) << "p = " << probability;
+    }
+}
+
+TEST_F(RandomTest, RandomBernoulli_EdgeProbabilities)
+{
+    for (int i = 0; i < 100; ++i) {
+        EXPECT_FALSE(randomBernoulli(0.0));
+        EXPECT_TRUE(randomBernoulli(1.0));
+    }
+    EXPECT_THROW(randomBernoulli(-0.1), std::invalid_argument);
+    EXPECT_THROW(randomBernoulli(1.1), std::invalid_argument);
+    EXPECT_THROW(randomBernoulli(std::numeric_limits<double>::quiet_NaN()), std::invalid_argument);
+}
+
+TEST_F(RandomTest, RandomBoolMask_ClearsUnusedBits)
+{
+    std::uint64_t masks[2];
+    randomBoolMask(masks, 70);
+
+    EXPECT_EQ(masks[1] >> 6, 0u);
+}
+
+TEST_F(RandomTest, RandomBernoulliMask_MatchesProbability)
+{
+    setSeed(408);
+    for (double probability : {0.0, 0.05, 0.25, 0.6, 0.95, 1.0}) {
+        std::vector<std::uint64_t> masks(1000);
+        randomBernoulliMask(masks.data(), masks.size() * 64, probability);
+
+        std::size_t successes = 0;
+        for (std::uint64_t mask : masks) {
+            for (int bit = 0; bit < 64; ++bit) {
+                successes += (mask >> bit) & 1u;
+            }
+        }
+        const double trials = 64000.0;
+        const double tolerance = 5.0 * std::sqrt(trials * probability * (1.0 - probability)) + 0.5;
+        EXPECT_NEAR(static_cast<double>(successes), trials * probability, tolerance) << "p = " << probability;
+    }
+}
+
+TEST_F(RandomTest, RandomBernoulliMask_PartialWordAndInvalidProbability)
+{
+    std::uint64_t mask = 0;
+    randomBernoulliMask(&mask, 10, 1.0);
+    EXPECT_EQ(mask, 0x3FFu);
+
+    EXPECT_THROW(randomBernoulliMask(&mask, 10, 2.0), std::invalid_argument);
+}
+
+TEST_F(RandomTest, RandomBernoulli_ConsumesBitsLikeSerialComparison)
+{
+    // Reference: compare U against p digit by digit using randomBool()
+    auto serialBernoulli = [](double probability) {
+        double remaining = probability;
+        while (remaining > 0.0) {
+            remaining *= 2.0;
+            const bool probabilityBit = remaining >= 1.0;
+            if (probabilityBit) {
+                remaining -= 1.0;
+            }
+            if (randomBool() != probabilityBit) {
+                return probabilityBit;
+            }
+        }
+        return false;
+    };
+
+    for (double probability : {0.3, 0.5, 0.0625, 1.0 / 3.0, 0.999999}) {
+        setSeed(409);
+        std::vector<bool> expected;
+        for (int i = 0; i < 500; ++i) {
+            expected.push_back(serialBernoulli(probability));
+        }
+
+        setSeed(409);
+        std::vector<bool> actual;
+        for (int i = 0; i < 500; ++i) {
+            actual.push_back(randomBernoulli(probability));
+        }
+
+        EXPECT_EQ(actual, expected) << "p = " << probability;
+    }
+}
@@ -0,0 +1,211 @@
+/**
+ * test_random_id.cpp
+ *
+ * Unit tests for the UUID, token and integer id generators in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cstring>
+#include <set>
+#include <string>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for random id tests
+class RandomIdTest : public ::testing::Test
+{
+protected:
+    static bool isLowerHex(char c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'a' && c <= 'f');
+    }
+
+    static bool isBase62(char c)
+    {
+        return (c >= '0' && c <= '9') || (c >= 'A' && c <= 'Z') || (c >= 'a' && c <= 'z');
+    }
+
+    static void expectValidUuid(const std::string& uuid)
+    {
+        ASSERT_EQ(uuid.size(), uuidLength);
+        for (std::size_t i = 0; i < uuid.size(); ++i) {
+            if (i == 8 || i == 13 || i == 18 || i == 23) {
+                EXPECT_EQ(uuid[i], '-') << uuid;
+            } else {
+                EXPECT_TRUE(isLowerHex(uuid[i])) << uuid;
+            }
+        }
+        EXPECT_EQ(uuid[14], '4') << uuid;
+        EXPECT_NE(std::strchr("89ab", uuid[19]), nullptr) << uuid;
+    }
+};
+
+// Tests for the encoders
+TEST_F(RandomIdTest, Encoders_KnownValues)
+{
+    char hex[8];
+    detail::writeHex32(0x0123abcdu, hex);
+    EXPECT_EQ(std::string(hex, 8), "0123abcd");
+    detail::writeHex32(0xfedc9876u, hex);
+    EXPECT_EQ(std::string(hex, 8), "fedc9876");
+
+    char uuid[uuidLength];
+    detail::encodeUuid(0x0011223344556677ull, 0x8899aabbccddeeffull, uuid);
+    EXPECT_EQ(std::string(uuid, uuidLength), "00112233-4455-4677-8899-aabbccddeeff");
+    detail::encodeUuid(~0ull, ~0ull, uuid);
+    EXPECT_EQ(std::string(uuid, uuidLength), "ffffffff-ffff-4fff-bfff-ffffffffffff");
+
+    std::string alphabet;
+    for (std::uint32_t value = 0; value < 62; ++value) {
+        alphabet += detail::base62Digit(value);
+    }
+    EXPECT_EQ(alphabet, "0123456789ABCDEFGHIJKLMNOPQRSTUVWXYZabcdefghijklmnopqrstuvwxyz");
+}
+
+// Tests for randomUuid
+TEST_F(RandomIdTest, Uuid_HasVersionAndVariant)
+{
+    for (int i = 0; i < 200; ++i) {
+        expectValidUuid(randomUuidString());
+        expectValidUuid(randomUuidString(IdEntropy::Os));
+    }
+}
+
+TEST_F(RandomIdTest, Uuid_WritesExactlyUuidLength)
+{
+    char buffer[uuidLength + 1];
+    std::memset(buffer, '#', sizeof(buffer));
+    randomUuid(buffer);
+    EXPECT_EQ(buffer[uuidLength], '#');
+    expectValidUuid(std::string(buffer, uuidLength));
+}
+
+TEST_F(RandomIdTest, UuidBatch_AllValidAndUnique)
+{
+    for (IdEntropy entropy : {IdEntropy::Fast, IdEntropy::Os}) {
+        const std::size_t count = 1000;
+        std::vector<char> buffer(count * uuidLength);
+        randomUuidBatch(buffer.data(), count, entropy);
+
+        std::set<std::string> seen;
+        for (std::size_t i = 0; i < count; ++i) {
+            const std::string uuid(buffer.data() + i * uuidLength, uuidLength);
+            expectValidUuid(uuid);
+            seen.insert(uuid);
+        }
+        EXPECT_EQ(seen.size(), count);
+    }
+}
+
+TEST_F(RandomIdTest, Uuid_FastIsReproducibleAfterSetSeed)
+{
+    setSeed(2024);
+    const std::string first = randomUuidString();
+    std::vector<char> batch(3 * uuidLength);
+    randomUuidBatch(batch.data(), 3);
+
+    setSeed(2024);
+    EXPECT_EQ(randomUuidString(), first);
+    std::vector<char> again(3 * uuidLength);
+    randomUuidBatch(again.data(), 3);
+    EXPECT_EQ(batch, again);
+}
+
+// Tests for randomToken
+TEST_F(RandomIdTest, Token_LengthAndAlphabet)
+{
+    for (std::size_t length : {0u, 1u, 9u, 10u, 11u, 22u, 64u}) {
+        const std::string token = randomTokenString(length);
+        ASSERT_EQ(token.size(), length);
+        for (char c : token) {
+            EXPECT_TRUE(isBase62(c)) << token;
+        }
+        const std::string secure = randomTokenString(length, IdEntropy::Os);
+        ASSERT_EQ(secure.size(), length);
+        for (char c : secure) {
+            EXPECT_TRUE(isBase62(c)) << secure;
+        }
+    }
+}
+
+TEST_F(RandomIdTest, Token_WritesExactlyLength)
+{
+    char buffer[23];
+    std::memset(buffer, '#', sizeof(buffer));
+    randomToken(buffer, 22);
+    EXPECT_EQ(buffer[22], '#');
+}
+
+TEST_F(RandomIdTest, Token_EveryCharIsRoughlyUniform)
+{
+    setSeed(7);
+    const std::size_t count = 10000;
+    const std::size_t length = 31;
+    std::vector<char> tokens(count * length);
+    randomTokenBatch(tokens.data(), count, length);
+
+    int histogram[62] = {};
+    for (char c : tokens) {
+        ASSERT_TRUE(isBase62(c));
+        const int value = c <= '9' ? c - '0' : c <= 'Z' ? c - 'A' + 10 : c - 'a' + 36;
+        ++histogram[value];
+    }
+    // 5000 expected per char; a 6-bit modulo would double the first two
+    const double expected = static_cast<double>(tokens.size()) / 62.0;
+    for (int value = 0; value < 62; ++value) {
+        EXPECT_NEAR(histogram[value], expected, expected * 0.08) << value;
+    }
+}
+
+TEST_F(RandomIdTest, TokenBatch_UniqueAndReproducible)
+{
+    setSeed(99);
+    const std::size_t count = 2000;
+    std::vector<char> tokens(count * 16);
+    randomTokenBatch(tokens.data(), count, 16);
+
+    std::set<std::string> seen;
+    for (std::size_t i = 0; i < count; ++i) {
+        seen.emplace(tokens.data() + i * 16, 16);
+    }
+    EXPECT_EQ(seen.size(), count);
+
+    setSeed(99);
+    std::vector<char> again(count * 16);
+    randomTokenBatch(again.data(), count, 16);
+    EXPECT_EQ(tokens, again);
+}
+
+// Tests for the integer ids
+TEST_F(RandomIdTest, IntegerIds_UniqueAndUseAllBits)
+{
+    for (IdEntropy entropy : {IdEntropy::Fast, IdEntropy::Os}) {
+        std::vector<std::uint64_t> ids(1000);
+        randomId64Batch(ids.data(), ids.size(), entropy);
+        std::uint64_t seenBits = 0;
+        for (std::uint64_t id : ids) {
+            seenBits |= id;
+        }
+        EXPECT_EQ(seenBits, ~0ull);
+        EXPECT_EQ(std::set<std::uint64_t>(ids.begin(), ids.end()).size(), ids.size());
+
+        std::vector<Id128> wide(1000);
+        randomId128Batch(wide.data(), wide.size(), entropy);
+        EXPECT_EQ(std::set<Id128>(wide.begin(), wide.end()).size(), wide.size());
+        EXPECT_NE(randomId64(entropy), randomId64(entropy));
+        EXPECT_NE(randomId128(entropy), randomId128(entropy));
+    }
+}
+
+TEST_F(RandomIdTest, IntegerIds_FastIsReproducibleAfterSetSeed)
+{
+    setSeed(5);
+    const std::uint64_t first = randomId64();
+    const Id128 second = randomId128();
+
+    setSeed(5);
+    EXPECT_EQ(randomId64(), first);
+    EXPECT_EQ(randomId128(), second);
+}
@@ -0,0 +1,180 @@
+/**
+ * test_random_integral.cpp
+ *
+ * Unit tests for the generic integer random functions in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cstdint>
+#include <cstring>
+#include <limits>
+#include <map>
+#include <set>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for generic integer tests
+class RandomIntegralTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        setSeed(4321);
+    }
+
+    // Every value of a small closed range shows up, and nothing outside it
+    template <typename T>
+    static void expectCoversRange(T lowerBound, T upperBound)
+    {
+        std::set<T> seen;
+        for (int i = 0; i < 5000; ++i) {
+            const T value = randomIntegral<T>(lowerBound, upperBound);
+            ASSERT_GE(value, lowerBound);
+            ASSERT_LE(value, upperBound);
+            seen.insert(value);
+        }
+        EXPECT_EQ(seen.size(), static_cast<std::size_t>(upperBound - lowerBound) + 1);
+    }
+};
+
+// Tests for multiplyFull64
+TEST_F(RandomIntegralTest, MultiplyFull64_KnownProducts)
+{
+    std::uint64_t low = 0;
+    EXPECT_EQ(detail::multiplyFull64(~0ull, ~0ull, low), ~0ull - 1);
+    EXPECT_EQ(low, 1u);
+    EXPECT_EQ(detail::multiplyFull64(1ull << 32, 1ull << 32, low), 1u);
+    EXPECT_EQ(low, 0u);
+    EXPECT_EQ(detail::multiplyFull64(0x123456789ull, 10, low), 0u);
+    EXPECT_EQ(low, 0xB60B60B5Aull);
+}
+
+// Tests for randomIntegral
+TEST_F(RandomIntegralTest, RandomIntegral_EveryTypeStaysInInclusiveRange)
+{
+    expectCoversRange<std::int8_t>(-3, 3);
+    expectCoversRange<std::uint8_t>(250, 255);
+    expectCoversRange<std::int16_t>(-20, -10);
+    expectCoversRange<std::uint16_t>(0, 9);
+    expectCoversRange<std::int32_t>(-5, 5);
+    expectCoversRange<std::uint32_t>(4294967290u, 4294967295u);
+    expectCoversRange<std::int64_t>(std::numeric_limits<std::int64_t>::min(), std::numeric_limits<std::int64_t>::min() + 7);
+    expectCoversRange<std::uint64_t>(std::numeric_limits<std::uint64_t>::max() - 7, std::numeric_limits<std::uint64_t>::max());
+}
+
+TEST_F(RandomIntegralTest, RandomIntegral_FullRangeReachesBothHalves)
+{
+    bool sawNegative = false;
+    bool sawPositive = false;
+    std::uint64_t seenBits = 0;
+    for (int i = 0; i < 200; ++i) {
+        const std::int64_t value = randomIntegral(std::numeric_limits<std::int64_t>::min(),
+                                                  std::numeric_limits<std::int64_t>::max());
+        sawNegative |= value < 0;
+        sawPositive |= value > 0;
+        seenBits |= randomIntegral<std::uint64_t>(0, std::numeric_limits<std::uint64_t>::max());
+    }
+    EXPECT_TRUE(sawNegative);
+    EXPECT_TRUE(sawPositive);
+    EXPECT_EQ(seenBits, ~0ull);
+}
+
+TEST_F(RandomIntegralTest, RandomIntegral_EmptyOrReversedReturnsLowerBound)
+{
+    EXPECT_EQ(randomIntegral<std::int64_t>(7, 7), 7);
+    EXPECT_EQ(randomIntegral<std::int64_t>(7, -7), 7);
+    EXPECT_EQ(randomIntegral<std::uint8_t>(200, 100), 200);
+}
+
+TEST_F(RandomIntegralTest, RandomIntegral_LargeRangeIsUnbiased)
+{
+    // 3 * 2^62 values: a modulo of a 64-bit draw would pick the lowest
+    // third twice as often as the rest
+    const std::uint64_t upperBound = 3 * (1ull << 62) - 1;
+    const std::uint64_t third = 1ull << 62;
+    int counts[3] = {};
+    for (int i = 0; i < 30000; ++i) {
+        ++counts[randomIntegral<std::uint64_t>(0, upperBound) / third];
+    }
+    for (int count : counts) {
+        EXPECT_NEAR(count, 10000, 500);
+    }
+}
+
+// Golden vector: mt19937_64 and the multiply are fully specified, so this
+// sequence must never change between compilers or standard libraries
+TEST_F(RandomIntegralTest, GoldenVector_RandomIntegral)
+{
+    const std::vector<std::uint64_t> expected = {357629722888ull, 400442617044ull, 689383317002ull,
+                                                 559735570641ull, 574451293991ull, 207690526861ull};
+
+    setSeed(12345);
+    for (std::uint64_t value : expected) {
+        EXPECT_EQ(randomIntegral<std::uint64_t>(0, 999999999999ull), value);
+    }
+
+    setSeed(12345);
+    const std::vector<int> small = {-29, -20, 38, 12, 15, -59, -95, 38};
+    for (int value : small) {
+        EXPECT_EQ(randomIntegral<std::int8_t>(-100, 100), value);
+    }
+}
+
+// Tests for the batch forms and randomBits
+TEST_F(RandomIntegralTest, RandomIntegralBatch_MatchesSingleCalls)
+{
+    std::vector<std::int64_t> batch(1000);
+    setSeed(77);
+    randomIntegralBatch<std::int64_t>(batch.data(), batch.size(), -1000000000000ll, 1000000000000ll);
+
+    setSeed(77);
+    for (std::size_t i = 0; i < batch.size(); ++i) {
+        ASSERT_EQ(batch[i], randomIntegral<std::int64_t>(-1000000000000ll, 1000000000000ll)) << i;
+    }
+
+    std::vector<std::uint64_t> full(100);
+    setSeed(77);
+    randomIntegralBatch<std::uint64_t>(full.data(), full.size(), 0, std::numeric_limits<std::uint64_t>::max());
+    setSeed(77);
+    for (std::uint64_t value : full) {
+        EXPECT_EQ(value, randomBits<std::uint64_t>());
+    }
+
+    std::vector<int> reversed(5, 0);
+    randomIntegralBatch(reversed.data(), reversed.size(), 9, 3);
+    EXPECT_EQ(reversed, std::vector<int>(5, 9));
+}
+
+TEST_F(RandomIntegralTest, RandomBitsBatch_PacksNarrowTypes)
+{
+    // Eight uint8_t per engine output, and a partial tail word
+    std::vector<std::uint8_t> bytes(1003);
+    randomBitsBatch(bytes.data(), bytes.size());
+
+    std::map<std::uint8_t, int> counts;
+    for (std::uint8_t value : bytes) {
+        ++counts[value];
+    }
+    EXPECT_GT(counts.size(), 240u);
+
+    setSeed(8);
+    std::uint16_t halves[4];
+    randomBitsBatch(halves, 4);
+    setSeed(8);
+    const std::uint64_t word = randomBits<std::uint64_t>();
+    std::uint64_t packed = 0;
+    std::memcpy(&packed, halves, sizeof(packed));
+    EXPECT_EQ(packed, word);
+}
+
+TEST_F(RandomIntegralTest, SetSeed_SeedsBothEngines)
+{
+    setSeed(99);
+    const std::uint64_t first = randomBits<std::uint64_t>();
+    const int firstInt = randomInt(0, 1000);
+    setSeed(99);
+    EXPECT_EQ(randomBits<std::uint64_t>(), first);
+    EXPECT_EQ(randomInt(0, 1000), firstInt);
+}
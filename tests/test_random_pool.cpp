@@ -0,0 +1,225 @@
+/**
+ * test_random_pool.cpp
+ *
+ * Unit tests for the RandomPool pre-generated random value buffer in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <cstdint>
+#include <ctime>
+#include <set>
+#include <thread>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for random pool tests
+class RandomPoolTest : public ::testing::Test
+{
+protected:
+    static constexpr int sampleSize = 1000;
+};
+
+TEST_F(RandomPoolTest, Capacity_RoundsUpToPowerOf2)
+{
+    RandomPool pool(1000);
+    EXPECT_EQ(pool.capacity(), 1024u);
+    EXPECT_EQ(pool.available(), 0u);
+}
+
+TEST_F(RandomPoolTest, Refill_FillsEveryFreeSlot)
+{
+    RandomPool pool(256);
+    EXPECT_EQ(pool.refill(), 256u);
+    EXPECT_EQ(pool.available(), 256u);
+    EXPECT_EQ(pool.refill(), 0u);
+
+    std::uint64_t value = 0;
+    EXPECT_TRUE(pool.tryPop(value));
+    EXPECT_EQ(pool.available(), 255u);
+    EXPECT_EQ(pool.refill(), 1u);
+}
+
+TEST_F(RandomPoolTest, TryPop_FailsWhenEmpty)
+{
+    RandomPool pool(16);
+    std::uint64_t value = 0;
+    EXPECT_FALSE(pool.tryPop(value));
+}
+
+TEST_F(RandomPoolTest, Next_FallsBackWhenEmpty)
+{
+    RandomPool pool(16);
+    std::set<std::uint64_t> values;
+    for (int i = 0; i < 10; ++i) {
+        values.insert(pool.next());
+    }
+
+    EXPECT_EQ(pool.fallbackCount(), 10u);
+    EXPECT_GT(values.size(), 1u);
+}
+
+TEST_F(RandomPoolTest, Next_FallbackLeavesGlobalEngineAlone)
+{
+    setSeed(7);
+    RandomPool pool(16);
+    for (int i = 0; i < 10; ++i) {
+        pool.next();
+    }
+    const std::uint32_t afterFallbacks = getRandomEngine()();
+
+    setSeed(7);
+    RandomPool unused(16);
+    EXPECT_EQ(getRandomEngine()(), afterFallbacks);
+}
+
+TEST_F(RandomPoolTest, Next_UsesPoolBeforeFallback)
+{
+    RandomPool pool(64);
+    pool.refill();
+    for (int i = 0; i < 64; ++i) {
+        pool.next();
+    }
+    EXPECT_EQ(pool.fallbackCount(), 0u);
+
+    pool.next();
+    EXPECT_EQ(pool.fallbackCount(), 1u);
+}
+
+TEST_F(RandomPoolTest, SetSeed_MakesPoolReproducible)
+{
+    std::vector<std::uint64_t> first;
+    std::vector<std::uint64_t> second;
+
+    setSeed(99);
+    {
+        RandomPool pool(128);
+        pool.refill();
+        for (int i = 0; i < 128; ++i) {
+            first.push_back(pool.next());
+        }
+    }
+
+    setSeed(99);
+    {
+        RandomPool pool(128);
+        pool.refill();
+        for (int i = 0; i < 128; ++i) {
+            second.push_back(pool.next());
+        }
+    }
+
+    EXPECT_EQ(first, second);
+}
+
+TEST_F(RandomPoolTest, NextInt_WithinRange)
+{
+    RandomPool pool;
+    pool.refill();
+    std::set<int> uniqueValues;
+    for (int i = 0; i < sampleSize; ++i) {
+        const int value = pool.nextInt(-5, 5);
+        EXPECT_GE(value, -5);
+        EXPECT_LT(value, 5);
+        uniqueValues.insert(value);
+    }
+    EXPECT_EQ(uniqueValues.size(), 10u);
+    EXPECT_EQ(pool.nextInt(7, 7), 7);
+}
+
+TEST_F(RandomPoolTest, NextFloat_WithinRange)
+{
+    RandomPool pool;
+    pool.refill();
+    for (int i = 0; i < sampleSize; ++i) {
+        const float value = pool.nextFloat(10.0f, 20.0f);
+        EXPECT_GE(value, 10.0f);
+        EXPECT_LE(value, 20.0f);
+    }
+}
+
+TEST_F(RandomPoolTest, NextFloat_MapsBitsLikeRandomFloat)
+{
+    std::vector<std::uint64_t> words;
+    std::vector<float> floats;
+
+    setSeed(5);
+    {
+        RandomPool pool(256);
+        pool.refill();
+        for (int i = 0; i < 256; ++i) {
+            words.push_back(pool.next());
+        }
+    }
+
+    setSeed(5);
+    {
+        RandomPool pool(256);
+        pool.refill();
+        for (int i = 0; i < 256; ++i) {
+            floats.push_back(pool.nextFloat(-3.7f, 12.1f));
+        }
+    }
+
+    // randomFloat()'s mapping: top 24 bits, double arithmetic, one rounding
+    const double span = static_cast<float>(12.1f - -3.7f);
+    for (std::size_t i = 0; i < words.size(); ++i) {
+        const double unit = static_cast<double>(words[i] >> 40) / 16777216.0;
+        const float expected = static_cast<float>(static_cast<double>(-3.7f) + span * unit);
+        EXPECT_EQ(floats[i], expected) << i;
+        EXPECT_EQ(floats[i], detail::floatFromBits(static_cast<std::uint32_t>(words[i] >> 40), -3.7f, 12.1f));
+    }
+}
+
+TEST_F(RandomPoolTest, BackgroundRefill_KeepsPoolStocked)
+{
+    RandomPool pool(1024);
+    pool.startBackgroundRefill();
+
+    const auto deadline = std::chrono::steady_clock::now() + std::chrono::seconds(5);
+    while (pool.available() < pool.capacity() && std::chrono::steady_clock::now() < deadline) {
+        std::this_thread::yield();
+    }
+    EXPECT_EQ(pool.available(), pool.capacity());
+
+    for (int i = 0; i < 100000; ++i) {
+        pool.next();
+    }
+    pool.stopBackgroundRefill();
+
+    EXPECT_LT(pool.fallbackCount(), 100000u);
+}
+
+TEST_F(RandomPoolTest, BackgroundRefill_SleepsWhileConsumerIsSlow)
+{
+    RandomPool pool(1024);
+    pool.startBackgroundRefill();
+
+    // One value per millisecond: a thread that refilled after every pop would
+    // burn a whole core for the duration
+    const std::clock_t cpuStart = std::clock();
+    const auto wallStart = std::chrono::steady_clock::now();
+    for (int i = 0; i < 100; ++i) {
+        pool.next();
+        std::this_thread::sleep_for(std::chrono::milliseconds(1));
+    }
+    const double cpuSeconds = static_cast<double>(std::clock() - cpuStart) / CLOCKS_PER_SEC;
+    const double wallSeconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - wallStart).count();
+    pool.stopBackgroundRefill();
+
+    EXPECT_LT(cpuSeconds, 0.5 * wallSeconds);
+}
+
+TEST_F(RandomPoolTest, WorksWithStandardDistributions)
+{
+    RandomPool pool;
+    pool.refill();
+    std::uniform_int_distribution<int> distribution(1, 6);
+    for (int i = 0; i < 100; ++i) {
+        const int roll = distribution(pool);
+        EXPECT_GE(roll, 1);
+        EXPECT_LE(roll, 6);
+    }
+}
@@ -0,0 +1,185 @@
+/**
+ * test_random_stream.cpp
+ *
+ * Unit tests for lazy random streams in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <random>
+#include <type_traits>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for random stream tests
+class RandomStreamTest : public ::testing::Test
+{
+protected:
+    static constexpr std::size_t count = 1000;
+
+    void SetUp() override
+    {
+        setSeed(8642);
+    }
+};
+
+TEST_F(RandomStreamTest, RandomFloatsMatchesRandomFloat)
+{
+    setSeed(21);
+    std::vector<float> expected(count);
+    for (float& value : expected) {
+        value = randomFloat(-3.0f, 7.0f);
+    }
+
+    setSeed(21);
+    auto stream = randomFloats(-3.0f, 7.0f);
+    std::vector<float> actual(count);
+    stream.fill(actual.data(), actual.size());
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomStreamTest, RandomIntsMatchesRandomInt)
+{
+    setSeed(22);
+    std::vector<int> expected(count);
+    for (int& value : expected) {
+        value = randomInt(5, 17);
+    }
+
+    setSeed(22);
+    auto stream = randomInts(5, 17);
+    std::vector<int> actual(count);
+    stream.fill(actual.data(), actual.size());
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomStreamTest, FusedPipelineMatchesStepByStepVersion)
+{
+    // The eager version: generate, round, filter, convert
+    setSeed(23);
+    std::vector<int> expected;
+    while (expected.size() < count) {
+        const float value = round(randomFloat(0.0f, 100.0f), 0);
+        if (in_range(value, 20.0f, 80.0f, BoundType::Exclusive)) {
+            expected.push_back(floatToInt(value));
+        }
+    }
+
+    setSeed(23);
+    auto stream = randomFloats(0.0f, 100.0f) | rounded(0) |
+                  keepInRange(20.0f, 80.0f, BoundType::Exclusive) | asInt();
+    std::vector<int> actual(count);
+    stream.fill(actual.data(), actual.size());
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomStreamTest, RoundedMatchesRound)
+{
+    auto raw = randomFloats(-10.0f, 10.0f);
+    auto stream = randomFloats(-10.0f, 10.0f) | rounded(2);
+
+    // Both streams draw from getRandomEngine(), so reseeding replays the same values
+    setSeed(25);
+    std::vector<float> rawValues(count);
+    raw.fill(rawValues.data(), rawValues.size());
+    setSeed(25);
+    std::vector<float> roundedValues(count);
+    stream.fill(roundedValues.data(), roundedValues.size());
+
+    for (std::size_t i = 0; i < count; ++i) {
+        EXPECT_EQ(roundedValues[i], round(rawValues[i], 2));
+    }
+}
+
+TEST_F(RandomStreamTest, FilterKeepsOnlyMatchingValues)
+{
+    auto stream = randomInts(0, 100) | keepInRange(10, 19);
+    std::vector<int> values(count);
+    stream.fill(values.data(), values.size());
+
+    for (int value : values) {
+        EXPECT_GE(value, 10);
+        EXPECT_LE(value, 19);
+    }
+}
+
+TEST_F(RandomStreamTest, MapValuesChangesType)
+{
+    auto stream = randomInts(0, 10) | mapValues([](int value) { return value * 0.5; });
+    static_assert(std::is_same_v<decltype(stream)::value_type, double>, "mapValues should change the value type");
+
+    for (int i = 0; i < 100; ++i) {
+        const double value = stream.next();
+        EXPECT_GE(value, 0.0);
+        EXPECT_LE(value, 4.5);
+        EXPECT_EQ(value, std::floor(value * 2.0) / 2.0);
+    }
+}
+
+TEST_F(RandomStreamTest, TakeYieldsExactlyCountAndThenContinues)
+{
+    setSeed(26);
+    std::vector<float> expected(30);
+    for (float& value : expected) {
+        value = randomFloat();
+    }
+
+    setSeed(26);
+    auto stream = randomFloats();
+    std::vector<float> actual;
+    for (float value : stream.take(10)) {
+        actual.push_back(value);
+    }
+    EXPECT_EQ(actual.size(), 10u);
+
+    for (int i = 0; i < 5; ++i) {
+        actual.push_back(stream.next());
+    }
+    std::vector<float> rest(15);
+    stream.fill(rest.data(), rest.size());
+    actual.insert(actual.end(), rest.begin(), rest.end());
+
+    EXPECT_EQ(actual, expected);
+}
+
+TEST_F(RandomStreamTest, TakeZeroIsEmpty)
+{
+    auto stream = randomFloats();
+    int iterations = 0;
+    for (float value : stream.take(0)) {
+        (void)value;
+        ++iterations;
+    }
+    EXPECT_EQ(iterations, 0);
+}
+
+TEST_F(RandomStreamTest, RangeForOverInfiniteStream)
+{
+    auto stream = randomInts(1, 7);
+    int seen = 0;
+    for (int value : stream) {
+        EXPECT_GE(value, 1);
+        EXPECT_LT(value, 7);
+        if (++seen == 600) {
+            break;
+        }
+    }
+    EXPECT_EQ(seen, 600);
+}
+
+TEST_F(RandomStreamTest, CustomEngineStream)
+{
+    std::mt19937 engineA(3);
+    std::mt19937 engineB(3);
+    auto first = randomFloats(0.0f, 1.0f, engineA) | rounded(1);
+    auto second = randomFloats(0.0f, 1.0f, engineB) | rounded(1);
+
+    for (int i = 0; i < 300; ++i) {
+        EXPECT_EQ(first.next(), second.next());
+    }
+}
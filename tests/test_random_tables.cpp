@@ -0,0 +1,314 @@
+/**
+ * test_random_tables.cpp
+ *
+ * Unit tests for the memory-mapped random tables in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <numeric>
+#include <random>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for random table tests
+class RandomTablesTest : public ::testing::Test
+{
+protected:
+    static constexpr std::uint64_t worldSeed = 0x5EED;
+
+    void SetUp() override
+    {
+        path_ = ::testing::TempDir() + "stevensMathLib_" +
+                ::testing::UnitTest::GetInstance()->current_test_info()->name() + ".tables";
+    }
+
+    void TearDown() override
+    {
+        std::remove(path_.c_str());
+    }
+
+    static RandomTableBuilder standardBuilder(std::uint64_t seed = worldSeed)
+    {
+        RandomTableBuilder builder(seed);
+        builder.addRandomWords("words", 10000).addPermutation("noise", 256).addAliasTable("loot", {5.0, 1.0, 0.0, 3.5});
+        return builder;
+    }
+
+    static std::vector<char> readBytes(const std::string& path)
+    {
+        std::ifstream file(path, std::ios::binary);
+        return std::vector<char>(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    static void writeBytes(const std::string& path, const std::vector<char>& bytes)
+    {
+        std::ofstream file(path, std::ios::binary | std::ios::trunc);
+        file.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+    }
+
+    // Temporaries RandomTableBuilder::write() left behind next to path_
+    int leftoverTemporaries() const
+    {
+        const std::filesystem::path target(path_);
+        const std::string prefix = target.filename().string() + ".tmp";
+        int count = 0;
+        for (const auto& entry : std::filesystem::directory_iterator(target.parent_path())) {
+            count += entry.path().filename().string().compare(0, prefix.size(), prefix) == 0;
+        }
+        return count;
+    }
+
+    std::string path_;
+};
+
+// Tests for building and loading
+TEST_F(RandomTablesTest, RoundTrip_BothLoadingModes)
+{
+    standardBuilder().write(path_);
+
+    for (TableLoading loading : {TableLoading::Map, TableLoading::Read}) {
+        const RandomTables tables(path_, worldSeed, loading);
+        EXPECT_EQ(tables.isMapped(), loading == TableLoading::Map);
+        EXPECT_EQ(tables.seed(), worldSeed);
+        EXPECT_EQ(tables.algorithmVersion(), randomTableAlgorithmVersion);
+        EXPECT_EQ(tables.tableCount(), 3u);
+        EXPECT_TRUE(tables.contains("noise"));
+        EXPECT_FALSE(tables.contains("nois"));
+        EXPECT_TRUE(tables.verify());
+
+        const RandomWordsView words = tables.randomWords("words");
+        ASSERT_EQ(words.size(), 10000u);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(words.data()) % 8, 0u);
+        std::uint64_t seenBits = 0;
+        for (std::uint64_t word : words) {
+            seenBits |= word;
+        }
+        EXPECT_EQ(seenBits, ~0ull);
+
+        const PermutationTableView noise = tables.permutation("noise");
+        std::vector<std::uint32_t> sorted(noise.begin(), noise.end());
+        std::sort(sorted.begin(), sorted.end());
+        std::vector<std::uint32_t> identity(256);
+        std::iota(identity.begin(), identity.end(), 0u);
+        EXPECT_EQ(sorted, identity);
+        EXPECT_FALSE(std::equal(noise.begin(), noise.end(), identity.begin()));
+    }
+}
+
+TEST_F(RandomTablesTest, AliasView_MatchesAliasTable)
+{
+    const std::vector<double> weights = {5.0, 1.0, 0.0, 3.5};
+    standardBuilder().write(path_);
+    const RandomTables tables(path_, worldSeed);
+    const AliasTableView view = tables.aliasTable("loot");
+    const AliasTable table(weights);
+    ASSERT_EQ(view.size(), table.size());
+
+    std::mt19937 viewEngine(11);
+    std::mt19937 tableEngine(11);
+    for (int i = 0; i < 10000; ++i) {
+        const std::size_t outcome = view.sample(viewEngine);
+        ASSERT_EQ(outcome, table.sample(tableEngine));
+        ASSERT_NE(outcome, 2u);
+    }
+}
+
+TEST_F(RandomTablesTest, Build_IsAPureFunctionOfSeedAndName)
+{
+    standardBuilder().write(path_);
+    const std::vector<char> first = readBytes(path_);
+    standardBuilder().write(path_);
+    EXPECT_EQ(readBytes(path_), first);
+
+    // A table does not depend on the other tables in its file
+    const std::string otherPath = path_ + ".other";
+    RandomTableBuilder(worldSeed).addPermutation("unrelated", 100).addRandomWords("words", 10).write(otherPath);
+    {
+        const RandomTables full(path_, worldSeed);
+        const RandomTables partial(otherPath, worldSeed);
+        const RandomWordsView a = full.randomWords("words");
+        const RandomWordsView b = partial.randomWords("words");
+        EXPECT_TRUE(std::equal(b.begin(), b.end(), a.begin()));
+    }
+    std::remove(otherPath.c_str());
+
+    const std::uint64_t firstWord = RandomTables(path_, worldSeed).randomWords("words")[0];
+    standardBuilder(worldSeed + 1).write(path_);
+    EXPECT_NE(RandomTables(path_, worldSeed + 1).randomWords("words")[0], firstWord);
+}
+
+TEST_F(RandomTablesTest, Write_ReplacesExistingFileAtomically)
+{
+    RandomTableBuilder(1).addRandomWords("a", 8).write(path_);
+    const RandomTables old(path_, 1);
+
+    RandomTableBuilder(2).addRandomWords("a", 4096).write(path_);
+    EXPECT_EQ(leftoverTemporaries(), 0);
+
+    // The old mapping still sees the old file; a new open sees the new one
+    EXPECT_EQ(old.randomWords("a").size(), 8u);
+    EXPECT_EQ(RandomTables(path_, 2).randomWords("a").size(), 4096u);
+}
+
+TEST_F(RandomTablesTest, Write_ConcurrentBuildersNeverInterleave)
+{
+    // Each builder writes its own temporary; every rename installs a complete file
+    std::vector<std::thread> builders;
+    for (int i = 0; i < 8; ++i) {
+        builders.emplace_back([this] {
+            RandomTableBuilder(worldSeed).addRandomWords("words", 200000).write(path_);
+        });
+    }
+    for (std::thread& builder : builders) {
+        builder.join();
+    }
+
+    const RandomTables tables(path_, worldSeed);
+    EXPECT_TRUE(tables.verify());
+    EXPECT_EQ(leftoverTemporaries(), 0);
+}
+
+// Tests for validation on open
+TEST_F(RandomTablesTest, Open_RejectsWrongSeedAndVersion)
+{
+    standardBuilder().write(path_);
+    EXPECT_THROW(RandomTables(path_, worldSeed + 1), std::runtime_error);
+
+    std::vector<char> bytes = readBytes(path_);
+    bytes[24] ^= 1; // algorithmVersion
+    writeBytes(path_, bytes);
+    EXPECT_THROW(RandomTables(path_, worldSeed), std::runtime_error);
+
+    bytes[24] ^= 1;
+    bytes[8] ^= 1; // formatVersion
+    writeBytes(path_, bytes);
+    EXPECT_THROW(RandomTables(path_, worldSeed), std::runtime_error);
+}
+
+TEST_F(RandomTablesTest, Open_RejectsDamagedFiles)
+{
+    EXPECT_THROW(RandomTables(path_ + ".missing", worldSeed), std::runtime_error);
+
+    standardBuilder().write(path_);
+    const std::vector<char> original = readBytes(path_);
+
+    for (TableLoading loading : {TableLoading::Map, TableLoading::Read}) {
+        std::vector<char> bytes = original;
+        bytes[0] = 'X'; // Magic
+        writeBytes(path_, bytes);
+        EXPECT_THROW(RandomTables(path_, worldSeed, loading), std::runtime_error);
+
+        bytes = original;
+        bytes.resize(bytes.size() - 64);
+        writeBytes(path_, bytes);
+        EXPECT_THROW(RandomTables(path_, worldSeed, loading), std::runtime_error);
+
+        bytes = original;
+        bytes[64 + 40] ^= 0x40; // First directory entry's count
+        writeBytes(path_, bytes);
+        EXPECT_THROW(RandomTables(path_, worldSeed, loading), std::runtime_error);
+
+        writeBytes(path_, std::vector<char>(10, 'S'));
+        EXPECT_THROW(RandomTables(path_, worldSeed, loading), std::runtime_error);
+    }
+}
+
+TEST_F(RandomTablesTest, Verify_DetectsPayloadCorruption)
+{
+    standardBuilder().write(path_);
+    std::vector<char> bytes = readBytes(path_);
+    bytes[bytes.size() / 2] ^= 0x10;
+    writeBytes(path_, bytes);
+
+    // Opening only checks the header and directory
+    const RandomTables tables(path_, worldSeed);
+    EXPECT_FALSE(tables.verify());
+}
+
+// Tests for the accessors and views
+TEST_F(RandomTablesTest, Accessors_RejectMissingOrMismatchedTables)
+{
+    standardBuilder().write(path_);
+    const RandomTables tables(path_, worldSeed);
+    EXPECT_THROW(tables.randomWords("absent"), std::out_of_range);
+    EXPECT_THROW(tables.randomWords("noise"), std::invalid_argument);
+    EXPECT_THROW(tables.permutation("loot"), std::invalid_argument);
+    EXPECT_THROW(tables.aliasTable("words"), std::invalid_argument);
+}
+
+TEST_F(RandomTablesTest, Builder_RejectsInvalidTables)
+{
+    RandomTableBuilder builder(worldSeed);
+    EXPECT_THROW(builder.addRandomWords("", 10), std::invalid_argument);
+    EXPECT_THROW(builder.addRandomWords("a_name_that_is_too_long_", 10), std::invalid_argument);
+    EXPECT_NO_THROW(builder.addRandomWords("a_name_that_is_23_chars", 10));
+    EXPECT_THROW(builder.addPermutation("a_name_that_is_23_chars", 10), std::invalid_argument);
+    EXPECT_THROW(builder.addRandomWords("empty", 0), std::invalid_argument);
+    EXPECT_THROW(builder.addPermutation("empty", 0), std::invalid_argument);
+    EXPECT_THROW(builder.addAliasTable("zero", {0.0, 0.0}), std::invalid_argument);
+    EXPECT_THROW(builder.write(::testing::TempDir() + "no/such/dir/x.tables"), std::runtime_error);
+}
+
+TEST_F(RandomTablesTest, TableEngine_ReadsInOrderAndWraps)
+{
+    RandomTableBuilder(worldSeed).addRandomWords("words", 5).write(path_);
+    const RandomTables tables(path_, worldSeed);
+    const RandomWordsView words = tables.randomWords("words");
+
+    TableEngine engine = words.engine(3);
+    EXPECT_EQ(engine(), words[3]);
+    EXPECT_EQ(engine(), words[4]);
+    EXPECT_EQ(engine(), words[0]);
+    EXPECT_EQ(engine.position(), 1u);
+    EXPECT_EQ(words.engine(12).position(), 2u);
+
+    EXPECT_THROW(TableEngine(words.data(), 0), std::invalid_argument);
+    EXPECT_THROW(RandomWordsView(nullptr, 0).engine(), std::invalid_argument);
+}
+
+TEST_F(RandomTablesTest, TableEngine_DrivesLibraryGenerators)
+{
+    standardBuilder().write(path_);
+    const RandomTables tables(path_, worldSeed);
+    const RandomWordsView words = tables.randomWords("words");
+
+    // Two workers reading the same offset draw the same values
+    TableEngine first = words.engine(100);
+    TableEngine second = words.engine(100);
+    const RandomPermutation a(1000, first);
+    const RandomPermutation b(1000, second);
+    for (std::uint64_t i = 0; i < 1000; ++i) {
+        ASSERT_EQ(a.permute(i), b.permute(i));
+    }
+
+    std::uniform_int_distribution<int> die(1, 6);
+    int counts[7] = {};
+    TableEngine engine = words.engine();
+    for (int i = 0; i < 6000; ++i) {
+        ++counts[die(engine)];
+    }
+    for (int face = 1; face <= 6; ++face) {
+        EXPECT_NEAR(counts[face], 1000, 150);
+    }
+}
+
+TEST_F(RandomTablesTest, Move_KeepsViewsValid)
+{
+    standardBuilder().write(path_);
+    RandomTables tables(path_, worldSeed);
+    const PermutationTableView before = tables.permutation("noise");
+    const std::vector<std::uint32_t> values(before.begin(), before.end());
+
+    RandomTables moved(std::move(tables));
+    EXPECT_TRUE(std::equal(values.begin(), values.end(), before.begin()));
+    EXPECT_EQ(moved.permutation("noise").data(), before.data());
+}
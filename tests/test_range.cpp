@@ -6,6 +6,9 @@
 
 #include "../stevensMathLib.h"
 #include <gtest/gtest.h>
+#include <algorithm>
+#include <optional>
+#include <vector>
 
 using namespace stevensMathLib;
 
@@ -142,3 +145,100 @@ TEST_F(RangeTest, InRange_VerySmallFloats)
     EXPECT_TRUE(in_range(tiny, 0.0f, 0.00001f, BoundType::Inclusive));
     EXPECT_TRUE(in_range(tiny, 0.0f, 0.00001f, BoundType::Exclusive));
 }
+
+// Tests for IntervalIndex
+TEST_F(RangeTest, IntervalIndex_FindAll_MixedBoundTypes)
+{
+    const IntervalIndex<int> index({
+        {0, 10, BoundType::Inclusive},
+        {5, 15, BoundType::Exclusive},
+        {10, 20, BoundType::Inclusive},
+    });
+
+    auto sorted = [](std::vector<std::size_t> ids) {
+        std::sort(ids.begin(), ids.end());
+        return ids;
+    };
+
+    EXPECT_EQ(sorted(index.findAll(7)), (std::vector<std::size_t>{0, 1}));
+    EXPECT_EQ(sorted(index.findAll(10)), (std::vector<std::size_t>{0, 1, 2}));
+    EXPECT_EQ(sorted(index.findAll(5)), (std::vector<std::size_t>{0}));
+    EXPECT_EQ(sorted(index.findAll(15)), (std::vector<std::size_t>{2}));
+    EXPECT_TRUE(index.findAll(-1).empty());
+    EXPECT_TRUE(index.findAll(21).empty());
+}
+
+TEST_F(RangeTest, IntervalIndex_FindFirst_ReturnsLowestId)
+{
+    const IntervalIndex<float> index({
+        {50.0f, 60.0f},
+        {0.0f, 100.0f},
+        {55.0f, 56.0f},
+    });
+
+    EXPECT_EQ(index.findFirst(55.5f), std::optional<std::size_t>(0));
+    EXPECT_EQ(index.findFirst(70.0f), std::optional<std::size_t>(1));
+    EXPECT_FALSE(index.findFirst(100.5f).has_value());
+}
+
+TEST_F(RangeTest, IntervalIndex_EmptyIntervalsNeverMatch)
+{
+    const IntervalIndex<int> index({
+        {5, 5, BoundType::Exclusive},
+        {10, 0, BoundType::Inclusive},
+        {5, 5, BoundType::Inclusive},
+    });
+
+    EXPECT_EQ(index.size(), 3u);
+    EXPECT_EQ(index.findAll(5), (std::vector<std::size_t>{2}));
+    EXPECT_EQ(index.countMatches(7), 0u);
+}
+
+TEST_F(RangeTest, IntervalIndex_EmptyIndex)
+{
+    const IntervalIndex<int> index;
+    EXPECT_EQ(index.size(), 0u);
+    EXPECT_TRUE(index.findAll(0).empty());
+    EXPECT_FALSE(index.findFirst(0).has_value());
+}
+
+TEST_F(RangeTest, IntervalIndex_MatchesInRangeLoop)
+{
+    setSeed(2024);
+    std::vector<Interval<int>> intervals;
+    for (int i = 0; i < 500; ++i) {
+        const int lower = randomInt(-1000, 1000);
+        const int upper = lower + randomInt(0, 200);
+        const BoundType boundType = randomInt(0, 2) == 0 ? BoundType::Inclusive : BoundType::Exclusive;
+        intervals.push_back({lower, upper, boundType});
+    }
+    const IntervalIndex<int> index(intervals);
+
+    for (int value = -1100; value <= 1300; value += 7) {
+        std::vector<std::size_t> expected;
+        for (std::size_t id = 0; id < intervals.size(); ++id) {
+            const Interval<int>& interval = intervals[id];
+            if (in_range(value, interval.lowerBound, interval.upperBound, interval.boundType)) {
+                expected.push_back(id);
+            }
+        }
+
+        std::vector<std::size_t> actual = index.findAll(value);
+        std::sort(actual.begin(), actual.end());
+        ASSERT_EQ(actual, expected) << "value " << value;
+    }
+}
+
+TEST_F(RangeTest, IntervalIndex_FindAllBatch_CsrLayout)
+{
+    const IntervalIndex<double> index({{0.0, 1.0}, {0.5, 2.0}});
+    const double values[] = {0.25, 0.75, 3.0};
+
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> ids;
+    index.findAllBatch(values, 3, offsets, ids);
+
+    ASSERT_EQ(offsets, (std::vector<std::size_t>{0, 1, 3, 3}));
+    EXPECT_EQ(ids[0], 0u);
+    EXPECT_EQ(index.countMatches(0.75), 2u);
+}
@@ -0,0 +1,243 @@
+/**
+ * test_range_math.cpp
+ *
+ * Unit tests for clamp, remap, lerp, inverseLerp and smoothstep in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <cmath>
+#include <cstring>
+#include <limits>
+#include <stdexcept>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for range math tests
+class RangeMathTest : public ::testing::Test
+{
+protected:
+    // Odd length so both the vector blocks and the scalar tail are exercised
+    static constexpr std::size_t batchSize = 1037;
+
+    static std::vector<float> floatData()
+    {
+        setSeed(321);
+        std::vector<float> values(batchSize);
+        for (float& value : values) {
+            value = randomFloat(-50.0f, 150.0f);
+        }
+        return values;
+    }
+};
+
+// Tests for clamp
+TEST_F(RangeMathTest, Clamp_Inclusive)
+{
+    EXPECT_EQ(clamp(5, 0, 10), 5);
+    EXPECT_EQ(clamp(-3, 0, 10), 0);
+    EXPECT_EQ(clamp(12, 0, 10), 10);
+    EXPECT_FLOAT_EQ(clamp(10.5f, 0.0f, 10.0f), 10.0f);
+}
+
+TEST_F(RangeMathTest, Clamp_ExclusiveIntegerMovesInByOne)
+{
+    EXPECT_EQ(clamp(12, 0, 10, BoundType::Exclusive), 9);
+    EXPECT_EQ(clamp(0, 0, 10, BoundType::Exclusive), 1);
+    EXPECT_EQ(clamp(5, 0, 10, BoundType::Exclusive), 5);
+}
+
+TEST_F(RangeMathTest, Clamp_ExclusiveFullIntegerRange)
+{
+    constexpr int intMin = std::numeric_limits<int>::min();
+    constexpr int intMax = std::numeric_limits<int>::max();
+    EXPECT_EQ(clamp(intMin, intMin, intMax, BoundType::Exclusive), intMin + 1);
+    EXPECT_EQ(clamp(intMax, intMin, intMax, BoundType::Exclusive), intMax - 1);
+    EXPECT_EQ(clamp(0, intMin, intMax, BoundType::Exclusive), 0);
+
+    constexpr long longMin = std::numeric_limits<long>::min();
+    constexpr long longMax = std::numeric_limits<long>::max();
+    EXPECT_EQ(clamp(longMax, longMin, longMax, BoundType::Exclusive), longMax - 1);
+    EXPECT_EQ(clamp(longMin, longMin, -1L, BoundType::Exclusive), longMin + 1);
+    EXPECT_EQ(clamp(0u, 0u, std::numeric_limits<unsigned>::max(), BoundType::Exclusive), 1u);
+
+    std::vector<int> values = {intMin, -1, intMax};
+    clampBatch(values.data(), values.data(), values.size(), intMin, intMax, BoundType::Exclusive);
+    EXPECT_EQ(values, (std::vector<int>{intMin + 1, -1, intMax - 1}));
+}
+
+TEST_F(RangeMathTest, Clamp_ExclusiveResultIsAcceptedByInRange)
+{
+    for (float value : {-1.0f, 0.0f, 0.5f, 1.0f, 2.0f}) {
+        const float clamped = clamp(value, 0.0f, 1.0f, BoundType::Exclusive);
+        EXPECT_TRUE(in_range(clamped, 0.0f, 1.0f, BoundType::Exclusive)) << value;
+    }
+    EXPECT_EQ(clamp(1.0, 0.0, 1.0, BoundType::Exclusive), std::nextafter(1.0, 0.0));
+}
+
+TEST_F(RangeMathTest, Clamp_InvalidRangesThrow)
+{
+    EXPECT_THROW(clamp(1, 10, 0), std::invalid_argument);
+    EXPECT_THROW(clamp(1, 4, 5, BoundType::Exclusive), std::invalid_argument);
+    EXPECT_THROW(clamp(1.0f, 2.0f, 2.0f, BoundType::Exclusive), std::invalid_argument);
+    EXPECT_EQ(clamp(1, 4, 4), 4);
+}
+
+// Tests for remap
+TEST_F(RangeMathTest, Remap_HitsEndpointsExactly)
+{
+    EXPECT_EQ(remap(0.1f, 0.1f, 0.7f, -3.3f, 9.9f), -3.3f);
+    EXPECT_EQ(remap(0.7f, 0.1f, 0.7f, -3.3f, 9.9f), 9.9f);
+    EXPECT_DOUBLE_EQ(remap(5.0, 0.0, 10.0, 100.0, 200.0), 150.0);
+}
+
+TEST_F(RangeMathTest, Remap_ReversedAndExtrapolated)
+{
+    EXPECT_FLOAT_EQ(remap(2.5f, 0.0f, 10.0f, 1.0f, 0.0f), 0.75f);
+    EXPECT_FLOAT_EQ(remap(20.0f, 0.0f, 10.0f, 0.0f, 1.0f), 2.0f);
+}
+
+TEST_F(RangeMathTest, Remap_IntegersRoundHalfAwayFromZero)
+{
+    EXPECT_EQ(remap(1023, 0, 1023, 0, 255), 255);
+    EXPECT_EQ(remap(512, 0, 1023, 0, 255), 128);
+    EXPECT_EQ(remap(1, 0, 2, 0, 1), 1);
+    EXPECT_EQ(remap(1, 0, 2, 0, -1), -1);
+}
+
+TEST_F(RangeMathTest, Remap_EmptySourceRangeThrows)
+{
+    EXPECT_THROW(remap(1.0f, 2.0f, 2.0f, 0.0f, 1.0f), std::invalid_argument);
+    EXPECT_THROW(remap(1, 2, 2, 0, 1), std::invalid_argument);
+}
+
+// Tests for lerp, inverseLerp and smoothstep
+TEST_F(RangeMathTest, Lerp_ExactAtEndsAndInverts)
+{
+    EXPECT_EQ(lerp(0.1f, 0.7f, 0.0f), 0.1f);
+    EXPECT_EQ(lerp(0.1f, 0.7f, 1.0f), 0.7f);
+    EXPECT_DOUBLE_EQ(lerp(-10.0, 10.0, 0.25), -5.0);
+    EXPECT_DOUBLE_EQ(inverseLerp(-10.0, 10.0, -5.0), 0.25);
+    EXPECT_DOUBLE_EQ(inverseLerp(-10.0, 10.0, lerp(-10.0, 10.0, 0.8)), 0.8);
+    EXPECT_THROW(inverseLerp(1.0, 1.0, 0.5), std::invalid_argument);
+}
+
+TEST_F(RangeMathTest, Smoothstep_MatchesHermiteCurve)
+{
+    EXPECT_EQ(smoothstep(0.0f, 1.0f, -1.0f), 0.0f);
+    EXPECT_EQ(smoothstep(0.0f, 1.0f, 2.0f), 1.0f);
+    EXPECT_FLOAT_EQ(smoothstep(0.0f, 1.0f, 0.5f), 0.5f);
+    EXPECT_FLOAT_EQ(smoothstep(0.0f, 1.0f, 0.25f), 0.15625f);
+    // Reversed edges mirror the curve, as in GLSL
+    EXPECT_FLOAT_EQ(smoothstep(1.0f, 0.0f, 0.25f), 0.84375f);
+    EXPECT_THROW(smoothstep(1.0f, 1.0f, 0.5f), std::invalid_argument);
+}
+
+// Tests for the batch kernels
+TEST_F(RangeMathTest, Batch_MatchesScalar)
+{
+    const std::vector<float> values = floatData();
+    std::vector<float> out(values.size());
+
+    clampBatch(values.data(), out.data(), values.size(), 0.0f, 100.0f, BoundType::Exclusive);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(out[i], clamp(values[i], 0.0f, 100.0f, BoundType::Exclusive)) << i;
+    }
+
+    remapBatch(values.data(), out.data(), values.size(), 0.0f, 100.0f, -1.0f, 1.0f);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(out[i], remap(values[i], 0.0f, 100.0f, -1.0f, 1.0f)) << i;
+    }
+
+    lerpBatch(values.data(), out.data(), values.size(), 3.0f, 7.0f);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(out[i], lerp(3.0f, 7.0f, values[i])) << i;
+    }
+
+    inverseLerpBatch(values.data(), out.data(), values.size(), -50.0f, 150.0f);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(out[i], inverseLerp(-50.0f, 150.0f, values[i])) << i;
+    }
+
+    smoothstepBatch(values.data(), out.data(), values.size(), 0.0f, 100.0f);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(out[i], smoothstep(0.0f, 100.0f, values[i])) << i;
+    }
+}
+
+TEST_F(RangeMathTest, Batch_IntegersAndDoubles)
+{
+    std::vector<int> ints(batchSize);
+    for (std::size_t i = 0; i < ints.size(); ++i) {
+        ints[i] = static_cast<int>(i) - 200;
+    }
+    std::vector<int> intOut(ints.size());
+
+    clampBatch(ints.data(), intOut.data(), ints.size(), 0, 500, BoundType::Exclusive);
+    for (std::size_t i = 0; i < ints.size(); ++i) {
+        ASSERT_EQ(intOut[i], clamp(ints[i], 0, 500, BoundType::Exclusive)) << i;
+    }
+
+    remapBatch(ints.data(), intOut.data(), ints.size(), 0, 1023, 0, 255);
+    for (std::size_t i = 0; i < ints.size(); ++i) {
+        ASSERT_EQ(intOut[i], remap(ints[i], 0, 1023, 0, 255)) << i;
+    }
+
+    std::vector<double> doubles(batchSize);
+    for (std::size_t i = 0; i < doubles.size(); ++i) {
+        doubles[i] = static_cast<double>(i) / static_cast<double>(batchSize - 1);
+    }
+    std::vector<double> doubleOut(doubles.size());
+    lerpBatch(doubles.data(), doubleOut.data(), doubles.size(), -10.0, 10.0);
+    EXPECT_EQ(doubleOut.front(), -10.0);
+    EXPECT_EQ(doubleOut.back(), 10.0);
+    for (std::size_t i = 0; i < doubles.size(); ++i) {
+        ASSERT_EQ(doubleOut[i], lerp(-10.0, 10.0, doubles[i])) << i;
+    }
+}
+
+TEST_F(RangeMathTest, Batch_InPlace)
+{
+    std::vector<float> values = floatData();
+    const std::vector<float> original = values;
+
+    clampBatch(values.data(), values.data(), values.size(), 0.0f, 100.0f);
+    for (std::size_t i = 0; i < values.size(); ++i) {
+        ASSERT_EQ(values[i], clamp(original[i], 0.0f, 100.0f)) << i;
+    }
+}
+
+TEST_F(RangeMathTest, Batch_EmptyAndInvalid)
+{
+    float value = 5.0f;
+    clampBatch(&value, &value, 0, 0.0f, 1.0f);
+    EXPECT_EQ(value, 5.0f);
+
+    EXPECT_THROW(clampBatch(&value, &value, 1, 1.0f, 0.0f), std::invalid_argument);
+    EXPECT_THROW(remapBatch(&value, &value, 1, 1.0f, 1.0f, 0.0f, 1.0f), std::invalid_argument);
+    EXPECT_THROW(smoothstepBatch(&value, &value, 1, 1.0f, 1.0f), std::invalid_argument);
+}
+
+TEST_F(RangeMathTest, Kernels_ScalarAndAvx2Agree)
+{
+    EXPECT_TRUE(std::strcmp(activeRangeKernel(), "avx2") == 0 || std::strcmp(activeRangeKernel(), "scalar") == 0);
+#if defined(STEVENSMATHLIB_X86_DISPATCH)
+    if (std::strcmp(activeRangeKernel(), "avx2") != 0) {
+        GTEST_SKIP() << "CPU has no AVX2";
+    }
+    const std::vector<float> values = floatData();
+    std::vector<float> scalar(values.size());
+    std::vector<float> avx2(values.size());
+
+    const auto op = detail::makeSmoothstepOp(0.0f, 100.0f, "smoothstep");
+    detail::applyRangeOpScalar(values.data(), scalar.data(), values.size(), op);
+    detail::applyRangeOpAvx2(values.data(), avx2.data(), values.size(), op);
+    EXPECT_EQ(std::memcmp(scalar.data(), avx2.data(), values.size() * sizeof(float)), 0);
+
+    const detail::RemapOp<float> remapOp{0.0f, 100.0f, -1.0f, 1.0f};
+    detail::applyRangeOpScalar(values.data(), scalar.data(), values.size(), remapOp);
+    detail::applyRangeOpAvx2(values.data(), avx2.data(), values.size(), remapOp);
+    EXPECT_EQ(std::memcmp(scalar.data(), avx2.data(), values.size() * sizeof(float)), 0);
+#endif
+}
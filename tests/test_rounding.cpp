@@ -7,6 +7,9 @@
 #include "../stevensMathLib.h"
 #include <gtest/gtest.h>
 #include <cmath>
+#include <limits>
+#include <string>
+#include <vector>
 
 using namespace stevensMathLib;
 
@@ -106,3 +109,115 @@ TEST_F(RoundingTest, Round_LargePrecision)
 {
     EXPECT_TRUE(floatsEqual(round(3.14159f, 5), 3.14159f));
 }
+
+// Tests for formatRounded and friends
+class FormatRoundedTest : public ::testing::Test
+{
+protected:
+    char buffer[64];
+
+    std::string formatted(std::size_t length) const
+    {
+        return std::string(buffer, length);
+    }
+};
+
+TEST_F(FormatRoundedTest, FormatRounded_FixedDigits)
+{
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), 3.14159f, 2)), "3.14");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), 2.5f, 3)), "2.500");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), 3.7f, 0)), "4");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), 0.05, 2)), "0.05");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), 1234567.0, 1)), "1234567.0");
+}
+
+TEST_F(FormatRoundedTest, FormatRounded_NegativeValues)
+{
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), -2.718f, 1)), "-2.7");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), -0.004f, 2)), "0.00");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), -0.25, 1)), "-0.3");
+}
+
+TEST_F(FormatRoundedTest, FormatRounded_MatchesRound)
+{
+    for (float value : {3.14159f, 2.718f, -7.125f, 1.99999f, 100.0f, 0.005f}) {
+        const std::size_t length = formatRounded(buffer, sizeof(buffer), value, 2);
+        EXPECT_FLOAT_EQ(std::stof(formatted(length)), round(value, 2)) << formatted(length);
+    }
+}
+
+TEST_F(FormatRoundedTest, FormatRounded_BufferTooSmall)
+{
+    EXPECT_EQ(formatRounded(buffer, 3, 3.14159f, 2), 0u);
+    EXPECT_EQ(formatRounded(buffer, 4, 3.14159f, 2), 4u);
+}
+
+TEST_F(FormatRoundedTest, FormatRounded_NonFiniteAndHuge)
+{
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), 1e30, 0)),
+              "1000000000000000019884624838656");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer),
+                                      std::numeric_limits<double>::infinity(), 2)), "inf");
+}
+
+TEST_F(FormatRoundedTest, FormatRoundedTrimmed_DropsTrailingZeros)
+{
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), 2.50f, 2)), "2.5");
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), 2.999f, 2)), "3");
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), 10.0f, 3)), "10");
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), -1.25, 2)), "-1.25");
+}
+
+TEST_F(FormatRoundedTest, FormatRoundedTrimmed_SlowPathTrimsToo)
+{
+    // Values past 2^64 once scaled, or more than 18 places, go through snprintf
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), 1e20, 1)), "100000000000000000000");
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), 2.5, 20)), "2.5");
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, 3, 2.5, 20)), "2.5");
+    EXPECT_EQ(formatted(formatRoundedTrimmed(buffer, sizeof(buffer), -1e-25, 20)), "0");
+    EXPECT_EQ(formatted(formatRounded(buffer, sizeof(buffer), -1e-25, 20)), "0.00000000000000000000");
+}
+
+TEST_F(FormatRoundedTest, FormatRounded_SlowPathCanFillBufferExactly)
+{
+    // "2.50000000000000000000" is 22 chars
+    EXPECT_EQ(formatted(formatRounded(buffer, 22, 2.5, 20)), "2.50000000000000000000");
+    EXPECT_EQ(formatRounded(buffer, 21, 2.5, 20), 0u);
+    EXPECT_EQ(formatRounded(buffer, 3, std::numeric_limits<double>::infinity(), 2), 3u);
+
+    // Places past what a double can hold are zero padding
+    std::vector<char> wide(2000);
+    EXPECT_EQ(formatRounded(wide.data(), wide.size(), 0.5, 1500), 1502u);
+    EXPECT_EQ(wide[1501], '0');
+    EXPECT_EQ(formatRoundedTrimmed(wide.data(), wide.size(), 0.5, 1500), 3u);
+}
+
+TEST_F(FormatRoundedTest, FormatNearest10th_MatchesRoundToNearest10th)
+{
+    EXPECT_EQ(formatted(formatNearest10th(buffer, sizeof(buffer), 3.14f)), "3.1");
+    EXPECT_EQ(formatted(formatNearest10th(buffer, sizeof(buffer), 4.96f)), "5");
+    EXPECT_EQ(formatted(formatNearest10th(buffer, sizeof(buffer), -2.47f)), "-2.5");
+    EXPECT_EQ(formatted(formatNearest10th(buffer, sizeof(buffer), 10.0f)), "10");
+}
+
+TEST_F(FormatRoundedTest, FormatRoundedBatch_WritesAllValues)
+{
+    const float values[] = {1.234f, 5.0f, -0.06f};
+    const FormatBatchResult result = formatRoundedBatch(values, 3, 1, buffer, sizeof(buffer), ',');
+
+    EXPECT_EQ(result.valuesWritten, 3u);
+    EXPECT_EQ(formatted(result.bytesWritten), "1.2,5.0,-0.1,");
+
+    const FormatBatchResult trimmed =
+        formatRoundedBatch(values, 3, 1, buffer, sizeof(buffer), ' ', true);
+    EXPECT_EQ(formatted(trimmed.bytesWritten), "1.2 5 -0.1 ");
+}
+
+TEST_F(FormatRoundedTest, FormatRoundedBatch_StopsWhenFull)
+{
+    const double values[] = {1.0, 2.0, 3.0};
+    const FormatBatchResult result = formatRoundedBatch(values, 3, 2, buffer, 10);
+
+    EXPECT_EQ(result.valuesWritten, 2u);
+    EXPECT_EQ(formatted(result.bytesWritten), "1.00\n2.00\n");
+}
@@ -0,0 +1,251 @@
+/**
+ * test_sampling.cpp
+ *
+ * Unit tests for reservoir sampling in stevensMathLib
+ */
+
+#include "../stevensMathLib.h"
+#include <gtest/gtest.h>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <numeric>
+#include <set>
+#include <vector>
+
+using namespace stevensMathLib;
+
+// Test fixture for stream sampling tests
+class SamplingTest : public ::testing::Test
+{
+protected:
+    static constexpr int trials = 2000;
+    static constexpr int streamSize = 100;
+    static constexpr std::size_t reservoirSize = 10;
+
+    void SetUp() override
+    {
+        setSeed(777);
+    }
+
+    static std::vector<int> stream(int size, int offset = 0)
+    {
+        std::vector<int> values(size);
+        std::iota(values.begin(), values.end(), offset);
+        return values;
+    }
+
+    // Returns the same 32-bit word on every call
+    struct ConstantEngine
+    {
+        std::uint32_t word;
+        std::uint32_t operator()() { return word; }
+    };
+};
+
+// Tests for the shared open-interval uniform
+TEST_F(SamplingTest, UniformOpenUnit_StaysStrictlyInside)
+{
+    ConstantEngine allOnes{0xFFFFFFFFu};
+    const double largest = detail::uniformOpenUnit(allOnes);
+    EXPECT_LT(largest, 1.0);
+    EXPECT_LT(std::log(largest), 0.0);
+    EXPECT_TRUE(std::isfinite(std::log1p(-largest)));
+
+    ConstantEngine allZeros{0u};
+    const double smallest = detail::uniformOpenUnit(allZeros);
+    EXPECT_GT(smallest, 0.0);
+    EXPECT_DOUBLE_EQ(smallest, std::ldexp(1.0, -53));
+    EXPECT_DOUBLE_EQ(largest, 1.0 - std::ldexp(1.0, -53));
+}
+
+// Tests for ReservoirSampler
+TEST_F(SamplingTest, Reservoir_KeepsEverythingWhenStreamIsShort)
+{
+    ReservoirSampler<int> sampler(reservoirSize);
+    for (int i = 0; i < 5; ++i) {
+        sampler.add(i);
+    }
+
+    std::vector<int> sample = sampler.sample();
+    std::sort(sample.begin(), sample.end());
+    EXPECT_EQ(sample, stream(5));
+    EXPECT_EQ(sampler.itemsSeen(), 5u);
+}
+
+TEST_F(SamplingTest, Reservoir_SampleIsDistinctStreamItems)
+{
+    ReservoirSampler<int> sampler(reservoirSize);
+    sampler.add(stream(100000));
+
+    const std::vector<int> sample = sampler.sample();
+    const std::set<int> unique(sample.begin(), sample.end());
+    EXPECT_EQ(sample.size(), reservoirSize);
+    EXPECT_EQ(unique.size(), reservoirSize);
+    EXPECT_GE(*unique.begin(), 0);
+    EXPECT_LT(*unique.rbegin(), 100000);
+    EXPECT_EQ(sampler.itemsSeen(), 100000u);
+}
+
+TEST_F(SamplingTest, Reservoir_InclusionIsUniform)
+{
+    std::vector<int> inclusionCounts(streamSize, 0);
+    const std::vector<int> items = stream(streamSize);
+
+    for (int trial = 0; trial < trials; ++trial) {
+        ReservoirSampler<int> sampler(reservoirSize);
+        for (int item : items) {
+            sampler.add(item);
+        }
+        for (int item : sampler.sample()) {
+            ++inclusionCounts[item];
+        }
+    }
+
+    // Each item is expected in trials * k / n = 200 samples
+    const double expected = static_cast<double>(trials) * reservoirSize / streamSize;
+    for (int count : inclusionCounts) {
+        EXPECT_NEAR(count, expected, expected * 0.35);
+    }
+
+    // Early and late halves of the stream must be equally represented
+    const int earlyTotal = std::accumulate(inclusionCounts.begin(), inclusionCounts.begin() + streamSize / 2, 0);
+    const int lateTotal = std::accumulate(inclusionCounts.begin() + streamSize / 2, inclusionCounts.end(), 0);
+    EXPECT_NEAR(earlyTotal, lateTotal, trials * reservoirSize * 0.05);
+}
+
+TEST_F(SamplingTest, Reservoir_BatchMatchesSingleAdds)
+{
+    const std::vector<int> items = stream(5000);
+
+    setSeed(42);
+    ReservoirSampler<int> single(reservoirSize);
+    for (int item : items) {
+        single.add(item);
+    }
+
+    setSeed(42);
+    ReservoirSampler<int> batch(reservoirSize);
+    batch.add(items.data(), 1234);
+    batch.add(items.data() + 1234, items.size() - 1234);
+
+    EXPECT_EQ(single.sample(), batch.sample());
+    EXPECT_EQ(single.itemsSeen(), batch.itemsSeen());
+}
+
+TEST_F(SamplingTest, Reservoir_MergeIsUniformOverBothStreams)
+{
+    int fromSmallStream = 0;
+    for (int trial = 0; trial < trials; ++trial) {
+        ReservoirSampler<int> small(reservoirSize);
+        ReservoirSampler<int> large(reservoirSize);
+        small.add(stream(100));
+        large.add(stream(300, 1000));
+
+        small.merge(large);
+        EXPECT_EQ(small.size(), reservoirSize);
+        for (int item : small.sample()) {
+            fromSmallStream += item < 1000 ? 1 : 0;
+        }
+    }
+
+    // A quarter of the combined stream came from the small sampler
+    const double expected = trials * reservoirSize * 0.25;
+    EXPECT_NEAR(fromSmallStream, expected, expected * 0.1);
+}
+
+TEST_F(SamplingTest, Reservoir_MergeOfPartialReservoirs)
+{
+    ReservoirSampler<int> first(reservoirSize);
+    ReservoirSampler<int> second(reservoirSize);
+    first.add(stream(3));
+    second.add(stream(4, 10));
+
+    first.merge(second);
+    EXPECT_EQ(first.size(), 7u);
+    EXPECT_EQ(first.itemsSeen(), 7u);
+}
+
+TEST_F(SamplingTest, Reservoir_InvalidArguments)
+{
+    EXPECT_THROW(ReservoirSampler<int>(0), std::invalid_argument);
+
+    ReservoirSampler<int> sampler(3);
+    EXPECT_THROW(sampler.merge(ReservoirSampler<int>(4)), std::invalid_argument);
+
+    sampler.add(std::vector<int>{1, 2, 3, 4, 5});
+    EXPECT_THROW(sampler.merge(sampler), std::invalid_argument);
+    EXPECT_EQ(sampler.size(), 3u);
+    EXPECT_EQ(sampler.itemsSeen(), 5u);
+}
+
+// Tests for WeightedReservoirSampler
+TEST_F(SamplingTest, Weighted_ZeroWeightNeverSelected)
+{
+    WeightedReservoirSampler<int> sampler(reservoirSize);
+    for (int i = 0; i < 1000; ++i) {
+        sampler.add(i, i % 2 == 0 ? 1.0 : 0.0);
+    }
+
+    for (int item : sampler.sample()) {
+        EXPECT_EQ(item % 2, 0);
+    }
+    EXPECT_DOUBLE_EQ(sampler.totalWeight(), 500.0);
+}
+
+TEST_F(SamplingTest, Weighted_InclusionFollowsWeights)
+{
+    // With k = 1 the inclusion probability is exactly weight / totalWeight
+    int heavyCount = 0;
+    for (int trial = 0; trial < trials * 5; ++trial) {
+        WeightedReservoirSampler<int> sampler(1);
+        for (int i = 0; i < 10; ++i) {
+            sampler.add(i, i == 7 ? 9.0 : 1.0);
+        }
+        heavyCount += sampler.sample().front() == 7 ? 1 : 0;
+    }
+
+    const double expected = trials * 5 * 0.5;
+    EXPECT_NEAR(heavyCount, expected, expected * 0.05);
+}
+
+TEST_F(SamplingTest, Weighted_MergeCombinesStreams)
+{
+    int fromFirst = 0;
+    for (int trial = 0; trial < trials; ++trial) {
+        WeightedReservoirSampler<int> first(1);
+        WeightedReservoirSampler<int> second(1);
+        first.add(1, 3.0);
+        second.add(2, 1.0);
+
+        first.merge(second);
+        fromFirst += first.sample().front() == 1 ? 1 : 0;
+    }
+
+    EXPECT_NEAR(fromFirst, trials * 0.75, trials * 0.05);
+}
+
+TEST_F(SamplingTest, Weighted_BatchAdd)
+{
+    const std::vector<int> items = stream(50);
+    const std::vector<double> weights(items.size(), 2.0);
+
+    WeightedReservoirSampler<int> sampler(reservoirSize);
+    sampler.add(items.data(), weights.data(), items.size());
+
+    EXPECT_EQ(sampler.size(), reservoirSize);
+    EXPECT_EQ(sampler.itemsSeen(), 50u);
+    EXPECT_DOUBLE_EQ(sampler.totalWeight(), 100.0);
+}
+
+TEST_F(SamplingTest, Weighted_InvalidArguments)
+{
+    EXPECT_THROW(WeightedReservoirSampler<int>(0), std::invalid_argument);
+
+    WeightedReservoirSampler<int> sampler(2);
+    EXPECT_THROW(sampler.add(1, -1.0), std::invalid_argument);
+
+    sampler.add(1, 1.0);
+    EXPECT_THROW(sampler.merge(sampler), std::invalid_argument);
+    EXPECT_EQ(sampler.size(), 1u);
+}